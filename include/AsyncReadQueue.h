@@ -0,0 +1,139 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_AsyncReadQueue_h
+#define Mezz_IOStreams_AsyncReadQueue_h
+
+/// @file
+/// @brief This file contains the queue used to service asynchronous Stream reads.
+
+#ifndef SWIG
+    #include "StreamBase.h"
+
+    #include <condition_variable>
+    #include <deque>
+    #include <functional>
+    #include <mutex>
+    #include <thread>
+#endif
+
+namespace Mezzanine
+{
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A pool of worker threads that perform read operations on behalf of other threads.
+    /// @details Each worker services one request at a time, so the number of workers is the number of reads
+    /// that can be waiting on the OS at once. Requests are serviced in the order they are submitted.
+    ///////////////////////////////////////
+    class MEZZ_LIB AsyncReadQueue
+    {
+    public:
+        /// @brief Convenience type for a read operation to be performed by the queue.
+        /// @remarks The return value is the number of bytes read and is used to fulfill the future returned
+        /// when the task was submitted.
+        using ReadTask = std::function<StreamSize()>;
+    protected:
+        /// @brief The threads servicing requests.
+        std::vector<std::thread> Workers;
+        /// @brief The requests that haven't been picked up by a worker yet.
+        std::deque< std::packaged_task<StreamSize()> > Pending;
+        /// @brief Mutex protecting the pending requests and shutdown flag.
+        std::mutex QueueLock;
+        /// @brief Condition the workers wait on until requests are available.
+        std::condition_variable QueueCondition;
+        /// @brief Whether or not the workers should exit once the queue is empty.
+        Boole ShuttingDown = false;
+
+        /// @brief The function each worker thread runs.
+        void ServiceRequests();
+    public:
+        /// @brief Class constructor.
+        /// @param ThreadCount The number of worker threads to create. At least one will be created.
+        explicit AsyncReadQueue(const size_t ThreadCount);
+        /// @brief Copy constructor.
+        /// @param Other The other queue to not be copied.
+        AsyncReadQueue(const AsyncReadQueue& Other) = delete;
+        /// @brief Move constructor.
+        /// @param Other The other queue to not be moved.
+        AsyncReadQueue(AsyncReadQueue&& Other) = delete;
+        /// @brief Class destructor.
+        /// @remarks Blocks until every request that was submitted has completed.
+        ~AsyncReadQueue();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Operators
+
+        /// @brief Copy assignment operator.
+        /// @param Other The other queue to not be copied.
+        /// @return Returns a reference to this.
+        AsyncReadQueue& operator=(const AsyncReadQueue& Other) = delete;
+        /// @brief Move assignment operator.
+        /// @param Other The other queue to not be moved.
+        /// @return Returns a reference to this.
+        AsyncReadQueue& operator=(AsyncReadQueue&& Other) = delete;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Requests
+
+        /// @brief Adds a read operation to the queue.
+        /// @remarks Any exception thrown by the task will be rethrown when the result is retrieved from the future.
+        /// @param Task The read to be performed by a worker thread.
+        /// @return Returns a future that will contain the number of bytes read once the task has completed.
+        [[nodiscard]] std::future<StreamSize> Submit(ReadTask Task);
+
+        /// @brief Gets the number of worker threads servicing this queue.
+        /// @return Returns the maximum number of requests this queue will process at once.
+        [[nodiscard]] size_t GetThreadCount() const noexcept;
+        /// @brief Gets the number of requests that have not been picked up by a worker.
+        /// @return Returns the number of requests waiting in this queue.
+        [[nodiscard]] size_t GetPendingCount();
+
+        /// @brief Gets the queue used by Streams when performing asynchronous reads.
+        /// @remarks The default queue is created on first use and has a worker for each hardware thread, with
+        /// a minimum of four since most of the time the workers will be waiting on I/O rather than the CPU.
+        /// @return Returns a reference to the shared default queue.
+        [[nodiscard]] static AsyncReadQueue& GetDefault();
+    };//AsyncReadQueue
+
+    RESTORE_WARNING_STATE
+}//Mezzanine
+
+#endif
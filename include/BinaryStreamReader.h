@@ -42,7 +42,11 @@
 
 #ifndef SWIG
     #include "BinaryBuffer.h"
+    #include "BufferPool.h"
+    #include "EndianTools.h"
+    #include "FloatTools.h"
     #include "InputStream.h"
+    #include "StreamTools.h"
 #endif
 
 namespace Mezzanine
@@ -55,35 +59,156 @@ namespace Mezzanine
     protected:
         /// @brief A pointer to the Stream being read from.
         StdInputStreamPtr Stream;
+        /// @brief The reusable buffer returned by ReadView.
+        BufferPool::BufferPtr Scratch;
+        /// @brief The number of bytes the reusable buffer can hold.
+        size_t ScratchCapacity = 0;
+
+        /// @brief Reads a fixed size record, copying straight from the buffer of the Stream when possible.
+        /// @param Record The buffer to read into.
+        /// @param Size The number of bytes in the record.
+        /// @return Returns true if the whole record was read, false otherwise.
+        Boole ReadRecord(void* Record, const size_t Size);
     public:
         /// @brief Stream constructor.
         /// @param Input The Stream to read from.
         BinaryStreamReader(StdInputStreamPtr Input);
+        /// @brief Copy constructor.
+        /// @remarks The copy reads from the same Stream, but does not share the reusable buffer.
+        /// @param Other The other reader to be copied.
+        BinaryStreamReader(const BinaryStreamReader& Other);
+        /// @brief Move constructor.
+        /// @param Other The other reader to be moved.
+        BinaryStreamReader(BinaryStreamReader&& Other) = default;
         /// @brief Class destructor.
         ~BinaryStreamReader() = default;
 
+        /// @brief Copy assignment operator.
+        /// @remarks The copy reads from the same Stream, but does not share the reusable buffer.
+        /// @param Other The other reader to be copied.
+        /// @return Returns a reference to this.
+        BinaryStreamReader& operator=(const BinaryStreamReader& Other);
+        /// @brief Move assignment operator.
+        /// @param Other The other reader to be moved.
+        /// @return Returns a reference to this.
+        BinaryStreamReader& operator=(BinaryStreamReader&& Other) = default;
+
         ///////////////////////////////////////////////////////////////////////////////
         // Reading
 
         /// @brief Reads N bytes from the Stream.
         /// @remarks This will also advance the Stream position by the number of bytes read. The read operation
         /// may not read the amount of bytes specified. To verify, check the Size member on the returned
-        /// BinaryBuffer.
+        /// BinaryBuffer. @n @n
+        /// This allocates a new buffer on every call. Prefer the other overloads when reading in a loop.
         /// @param Bytes The number of bytes to read from the Stream.
         /// @return Returns a BinaryBuffer containing the data read from the Stream.
         [[nodiscard]] BinaryBuffer Read(const StreamSize Bytes);
+        /// @brief Reads up to N bytes from the Stream into a caller provided buffer.
+        /// @param Buffer The buffer to read into. Must be at least Bytes in size.
+        /// @param Bytes The number of bytes to read from the Stream.
+        /// @return Returns the number of bytes actually read.
+        StreamSize Read(void* Buffer, const StreamSize Bytes);
+        /// @brief Fills a caller provided BinaryBuffer from the Stream.
+        /// @remarks The Size of the buffer is not changed, even if fewer bytes are available.
+        /// @param Buffer The buffer to read into. Up to its Size bytes will be read.
+        /// @return Returns the number of bytes actually read.
+        StreamSize Read(BinaryBuffer& Buffer);
+        /// @brief Reads N bytes from the Stream into a buffer owned and reused by this reader.
+        /// @remarks The buffer only ever grows, so reading in a loop allocates only until the largest read
+        /// size has been seen. The returned view is invalidated by the next call to this method.
+        /// @param Bytes The number of bytes to read from the Stream.
+        /// @return Returns a view of the bytes actually read.
+        [[nodiscard]] StringView ReadView(const StreamSize Bytes);
         /// @brief Reads the value of a standard arithmetic type from the Stream.
         /// @remarks The Stream doesn't actually know what types are where in the Stream. It is expected
-        /// that the user of the Stream has taken precautions to make this coherent.
+        /// that the user of the Stream has taken precautions to make this coherent. @n @n
+        /// When the value is already in the buffer of the Stream it is copied out directly, and the full
+        /// read is only used at buffer boundaries.
         /// @tparam Datum The standard arithmetic type to read.
         /// @return Returns a value of the type Datum that was read from the Stream.
         template<typename Datum, typename = std::enable_if_t< std::is_arithmetic_v<Datum> >>
         [[nodiscard]] Datum Read()
         {
             Datum ToReturn{};
-            this->Stream->read(reinterpret_cast<char*>(&ToReturn),sizeof(Datum));
+            if( !StreamTools::TryReadBuffered(*this->Stream,&ToReturn,sizeof(Datum)) ) {
+                this->Stream->read(reinterpret_cast<char*>(&ToReturn),sizeof(Datum));
+            }
+            return ToReturn;
+        }
+        /// @brief Reads an array of a standard arithmetic type from the Stream in a single transfer.
+        /// @remarks If the data is not in the native byte order it is swapped in place after being read.
+        /// @tparam Datum The standard arithmetic type to read.
+        /// @param Values The array to populate with the read values.
+        /// @param Count The number of values to read.
+        /// @param Order The byte order the values are stored in within the Stream.
+        /// @return Returns the number of complete values actually read.
+        template<typename Datum, typename = std::enable_if_t< std::is_arithmetic_v<Datum> >>
+        size_t ReadArray(Datum* Values, const size_t Count, const ByteOrder Order = ByteOrder::Native)
+        {
+            this->Stream->read(reinterpret_cast<char*>(Values),static_cast<StreamSize>( Count * sizeof(Datum) ));
+            const size_t ValuesRead = static_cast<size_t>( this->Stream->gcount() ) / sizeof(Datum);
+            EndianTools::ConvertArray(Values,ValuesRead,Order);
+            return ValuesRead;
+        }
+        /// @brief Reads an array of floats stored in a smaller encoding.
+        /// @remarks The encoded values are read a few kilobytes at a time and decoded straight into Values.
+        /// @param Values The array to populate with the decoded floats.
+        /// @param Count The number of floats to read.
+        /// @param Encoding The encoding the floats are stored in within the Stream.
+        /// @param Order The byte order the encoded values are stored in within the Stream.
+        /// @return Returns the number of complete values actually read.
+        size_t ReadFloats(float* Values, const size_t Count, const FloatEncoding Encoding,
+                          const ByteOrder Order = ByteOrder::Native);
+        /// @brief Reads a fixed record of standard arithmetic types stored back to back without padding.
+        /// @remarks The size of the record is known at compile time, so the whole record is checked for and
+        /// transferred at once and then unpacked. If the Stream ends partway through the record, the fail bit
+        /// is set on the Stream and a tuple of zeros is returned.
+        /// @tparam Data The standard arithmetic types of the fields, in the order they are stored.
+        /// @param Order The byte order the fields are stored in within the Stream.
+        /// @return Returns a tuple of the values read.
+        template<typename... Data, typename = std::enable_if_t< ( std::is_arithmetic_v<Data> && ... ) >>
+        [[nodiscard]] std::tuple<Data...> ReadTuple(const ByteOrder Order = ByteOrder::Native)
+        {
+            static_assert(sizeof...(Data) > 0,"ReadTuple requires at least one field.");
+            char Packed[EndianTools::PackedSize<Data...>];
+            if( !this->ReadRecord(Packed,sizeof(Packed)) ) {
+                return std::tuple<Data...>();
+            }
+            return EndianTools::UnpackTuple<Data...>(Packed,Order,std::index_sequence_for<Data...>());
+        }
+        /// @brief Reads a trivially copyable struct from the Stream in a single transfer.
+        /// @remarks The struct is read exactly as it is laid out in memory, padding included, and no byte order
+        /// conversion is done. Use ReadTuple for records that may be stored in a foreign byte order. If the
+        /// Stream ends partway through the struct, the fail bit is set on the Stream and a value initialized
+        /// struct is returned.
+        /// @tparam Record The trivially copyable type to read.
+        /// @return Returns the struct read.
+        template<typename Record, typename = std::enable_if_t< std::is_trivially_copyable_v<Record> >>
+        [[nodiscard]] Record ReadStruct()
+        {
+            Record ToReturn{};
+            if( !this->ReadRecord(&ToReturn,sizeof(Record)) ) {
+                return Record{};
+            }
             return ToReturn;
         }
+        /// @brief Reads an unsigned integer stored as a LEB128 varint.
+        /// @remarks If the varint is malformed or the Stream ends partway through, the fail bit is set on the
+        /// Stream and 0 is returned.
+        /// @return Returns the value read.
+        [[nodiscard]] UInt64 ReadVarInt();
+        /// @brief Reads a signed integer stored as a zigzag mapped varint.
+        /// @remarks Errors are handled the same as ReadVarInt.
+        /// @return Returns the value read.
+        [[nodiscard]] Int64 ReadZigZag();
+        /// @brief Reads an array of unsigned integers stored with Stream VByte.
+        /// @remarks If the Stream ends before the whole array is read, the fail bit is set on the Stream and
+        /// no values are returned.
+        /// @param Values The array to populate with the read values.
+        /// @param Count The number of values that were written.
+        /// @return Returns the number of values read, either Count or 0.
+        size_t ReadStreamVByte(UInt32* Values, const size_t Count);
         /// @brief Advances the read position in the Stream.
         /// @remarks The return and Bytes will match if the operation was successful.
         /// @param Bytes The number of bytes to advance in the Stream.
@@ -42,7 +42,10 @@
 
 #ifndef SWIG
     #include "BinaryBuffer.h"
+    #include "EndianTools.h"
+    #include "FloatTools.h"
     #include "OutputStream.h"
+    #include "StreamTools.h"
 #endif
 
 namespace Mezzanine
@@ -55,6 +58,12 @@ namespace Mezzanine
     protected:
         /// @brief A pointer to the Stream being written to.
         StdOutputStreamPtr Stream;
+
+        /// @brief Writes a fixed size record, copying straight into the buffer of the Stream when possible.
+        /// @param Record The record to write.
+        /// @param Size The number of bytes in the record.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        Boole WriteRecord(const void* Record, const size_t Size);
     public:
         /// @brief Stream constructor.
         /// @param Output The Stream to read from.
@@ -72,15 +81,98 @@ namespace Mezzanine
         Boole Write(const BinaryBuffer& ToWrite);
 
         /// @brief Writes the value of a standard arithmetic type to the Stream.
+        /// @remarks When the buffer of the Stream has room the value is copied in directly, and the full
+        /// write is only used at buffer boundaries.
         /// @tparam Datum The standard arithmetic type to write.
         /// @param ToWrite The value to write to the Stream.
         /// @return Returns true if the Stream is still in a valid state after the Write.
         template<typename Datum, typename = std::enable_if_t< std::is_arithmetic_v<Datum> >>
         Boole Write(const Datum ToWrite)
         {
+            if( StreamTools::TryWriteBuffered(*this->Stream,&ToWrite,sizeof(Datum)) ) {
+                return true;
+            }
             this->Stream->write(reinterpret_cast<const char*>(&ToWrite),sizeof(Datum));
             return this->Stream->good();
         }
+        /// @brief Writes an array of a standard arithmetic type to the Stream.
+        /// @remarks In the native byte order this is a single transfer. Otherwise the values are swapped into a
+        /// small staging buffer and written a few kilobytes at a time, leaving the source array untouched.
+        /// @tparam Datum The standard arithmetic type to write.
+        /// @param Values The array of values to write.
+        /// @param Count The number of values to write.
+        /// @param Order The byte order to store the values in within the Stream.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        template<typename Datum, typename = std::enable_if_t< std::is_arithmetic_v<Datum> >>
+        Boole WriteArray(const Datum* Values, const size_t Count, const ByteOrder Order = ByteOrder::Native)
+        {
+            if( sizeof(Datum) == 1 || !EndianTools::NeedsSwap(Order) ) {
+                this->Stream->write(reinterpret_cast<const char*>(Values),static_cast<StreamSize>( Count * sizeof(Datum) ));
+                return this->Stream->good();
+            }
+            constexpr size_t StagingCount = 4096 / sizeof(Datum);
+            alignas(Datum) char Staging[StagingCount * sizeof(Datum)];
+            for( size_t Done = 0 ; Done < Count && this->Stream->good() ; Done += StagingCount )
+            {
+                const size_t Batch = std::min(StagingCount,Count - Done);
+                EndianTools::ByteSwapCopy(Staging,Values + Done,Batch,sizeof(Datum));
+                this->Stream->write(Staging,static_cast<StreamSize>( Batch * sizeof(Datum) ));
+            }
+            return this->Stream->good();
+        }
+
+        /// @brief Writes an array of floats in a smaller encoding.
+        /// @remarks The values are encoded into a small staging buffer and written a few kilobytes at a time,
+        /// leaving the source array untouched.
+        /// @param Values The array of floats to write.
+        /// @param Count The number of floats to write.
+        /// @param Encoding The encoding to store the floats in within the Stream.
+        /// @param Order The byte order to store the encoded values in within the Stream.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        Boole WriteFloats(const float* Values, const size_t Count, const FloatEncoding Encoding,
+                          const ByteOrder Order = ByteOrder::Native);
+        /// @brief Writes a fixed record of standard arithmetic types back to back without padding.
+        /// @remarks The size of the record is known at compile time, so it is packed into a local buffer and
+        /// written in a single transfer.
+        /// @tparam Data The standard arithmetic types of the fields, in the order they are stored.
+        /// @param Values The fields to write.
+        /// @param Order The byte order to store the fields in within the Stream.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        template<typename... Data, typename = std::enable_if_t< ( std::is_arithmetic_v<Data> && ... ) >>
+        Boole WriteTuple(const std::tuple<Data...>& Values, const ByteOrder Order = ByteOrder::Native)
+        {
+            static_assert(sizeof...(Data) > 0,"WriteTuple requires at least one field.");
+            char Packed[EndianTools::PackedSize<Data...>];
+            EndianTools::PackTuple(Packed,Values,Order,std::index_sequence_for<Data...>());
+            return this->WriteRecord(Packed,sizeof(Packed));
+        }
+        /// @brief Writes a trivially copyable struct to the Stream in a single transfer.
+        /// @remarks The struct is written exactly as it is laid out in memory, padding included, and no byte
+        /// order conversion is done. Use WriteTuple for records that need a specific byte order.
+        /// @tparam Record The trivially copyable type to write.
+        /// @param ToWrite The struct to write.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        template<typename Record, typename = std::enable_if_t< std::is_trivially_copyable_v<Record> >>
+        Boole WriteStruct(const Record& ToWrite)
+            { return this->WriteRecord(&ToWrite,sizeof(Record)); }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Variable Length Writing
+
+        /// @brief Writes an unsigned integer as a LEB128 varint, using 1 to 10 bytes.
+        /// @param ToWrite The value to write to the Stream.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        Boole WriteVarInt(const UInt64 ToWrite);
+        /// @brief Writes a signed integer as a zigzag mapped varint, so small negative values stay small.
+        /// @param ToWrite The value to write to the Stream.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        Boole WriteZigZag(const Int64 ToWrite);
+        /// @brief Writes an array of unsigned integers with Stream VByte, using 1 to 4 bytes for each value.
+        /// @remarks The number of values isn't written. It must be stored separately to read the array back.
+        /// @param Values The array of values to write.
+        /// @param Count The number of values to write.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        Boole WriteStreamVByte(const UInt32* Values, const size_t Count);
     };//BinaryStreamWriter
 }//Mezzanine
 
@@ -0,0 +1,130 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_BitStreamReader_h
+#define Mezz_IOStreams_BitStreamReader_h
+
+#ifndef SWIG
+    #include "InputStream.h"
+#endif
+
+namespace Mezzanine
+{
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An input Stream helper class for reading values that aren't a whole number of bytes.
+    /// @details Bits are unpacked least significant bit first, matching the BitStreamWriter. Bits are kept in a
+    /// 64-bit accumulator that is refilled from the Stream up to eight bytes at a time.
+    /// @n @n
+    /// Because of that, the Stream position runs ahead of the bits that have been read. Call
+    /// SyncStreamPosition before using the Stream directly.
+    ///////////////////////////////////////
+    class MEZZ_LIB BitStreamReader
+    {
+    public:
+        /// @brief The most bits that can be peeked at once.
+        static constexpr UInt32 MaxPeekBits = 56;
+    protected:
+        /// @brief A pointer to the Stream being read from.
+        StdInputStreamPtr Stream;
+        /// @brief Bits read from the Stream but not yet returned, starting from the least significant bit.
+        UInt64 Accumulator = 0;
+        /// @brief The total number of bits returned or skipped.
+        UInt64 TotalBits = 0;
+        /// @brief The number of bits in the accumulator.
+        UInt32 BitCount = 0;
+
+        /// @brief Tops up the accumulator with at least 56 bits, or as many as the Stream has left.
+        void Refill();
+        /// @brief Removes bits from the accumulator, refilling it first if needed.
+        /// @param Count The number of bits to remove, up to MaxPeekBits.
+        /// @param Value Set to the bits removed.
+        /// @return Returns true if there were enough bits, false if the Stream ran out.
+        Boole TakeBits(const UInt32 Count, UInt64& Value);
+    public:
+        /// @brief Stream constructor.
+        /// @param Input The Stream to read from.
+        BitStreamReader(StdInputStreamPtr Input);
+        /// @brief Deleted copy constructor.
+        BitStreamReader(const BitStreamReader&) = delete;
+        /// @brief Class destructor.
+        ~BitStreamReader() = default;
+
+        /// @brief Deleted copy assignment operator.
+        BitStreamReader& operator=(const BitStreamReader&) = delete;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Reading
+
+        /// @brief Reads a value stored in a number of bits.
+        /// @remarks If the Stream ends before Count bits can be read, 0 is returned and the fail bit is set on
+        /// the Stream.
+        /// @param Count The number of bits to read, from 0 to 64.
+        /// @return Returns the value read, in the low Count bits.
+        [[nodiscard]] UInt64 ReadBits(const UInt32 Count);
+        /// @brief Reads a single bit.
+        /// @return Returns the bit read, or false if the Stream has ended.
+        [[nodiscard]] Boole ReadBit();
+        /// @brief Gets the next bits without consuming them.
+        /// @remarks If fewer bits remain, the missing high bits are returned as zero.
+        /// @param Count The number of bits to look at, up to MaxPeekBits.
+        /// @return Returns the next Count bits.
+        [[nodiscard]] UInt64 PeekBits(const UInt32 Count);
+        /// @brief Discards bits.
+        /// @param Count The number of bits to skip.
+        /// @return Returns the number of bits actually skipped.
+        UInt64 SkipBits(const UInt64 Count);
+        /// @brief Discards the remaining bits of the current byte.
+        void AlignToByte();
+        /// @brief Aligns to the next byte and moves the Stream back to the first byte that hasn't been read.
+        /// @remarks The Stream must be able to seek back for this to succeed.
+        /// @return Returns true if the Stream position matches the bits read, false otherwise.
+        Boole SyncStreamPosition();
+
+        /// @brief Gets the number of bits read.
+        /// @return Returns the total number of bits read or skipped.
+        [[nodiscard]] UInt64 GetBitsRead() const;
+    };//BitStreamReader
+
+    RESTORE_WARNING_STATE
+}//Mezzanine
+
+#endif
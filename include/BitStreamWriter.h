@@ -0,0 +1,111 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_BitStreamWriter_h
+#define Mezz_IOStreams_BitStreamWriter_h
+
+#ifndef SWIG
+    #include "OutputStream.h"
+#endif
+
+namespace Mezzanine
+{
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An output Stream helper class for writing values that aren't a whole number of bytes.
+    /// @details Bits are packed least significant bit first. Each value starts at the lowest unused bit of the
+    /// current byte, and bytes are written in increasing order. Bits are gathered in a 64-bit accumulator and
+    /// written to the Stream eight bytes at a time.
+    /// @n @n
+    /// Bits still in the accumulator aren't in the Stream until AlignToByte is called. The destructor calls it.
+    ///////////////////////////////////////
+    class MEZZ_LIB BitStreamWriter
+    {
+    protected:
+        /// @brief A pointer to the Stream being written to.
+        StdOutputStreamPtr Stream;
+        /// @brief Bits waiting to be written, starting from the least significant bit.
+        UInt64 Accumulator = 0;
+        /// @brief The total number of bits written, including those still in the accumulator.
+        UInt64 TotalBits = 0;
+        /// @brief The number of bits in the accumulator. Always less than 64.
+        UInt32 BitCount = 0;
+
+        /// @brief Writes the full accumulator to the Stream.
+        /// @param Word The 64 bits to write.
+        void WriteWord(const UInt64 Word);
+    public:
+        /// @brief Stream constructor.
+        /// @param Output The Stream to write to.
+        BitStreamWriter(StdOutputStreamPtr Output);
+        /// @brief Deleted copy constructor.
+        BitStreamWriter(const BitStreamWriter&) = delete;
+        /// @brief Class destructor.
+        ~BitStreamWriter();
+
+        /// @brief Deleted copy assignment operator.
+        BitStreamWriter& operator=(const BitStreamWriter&) = delete;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Writing
+
+        /// @brief Writes the low bits of a value.
+        /// @param ToWrite The value to write. Bits above Count are ignored.
+        /// @param Count The number of bits to write, from 0 to 64.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        Boole WriteBits(const UInt64 ToWrite, const UInt32 Count);
+        /// @brief Writes a single bit.
+        /// @param ToWrite The bit to write.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        Boole WriteBit(const Boole ToWrite);
+        /// @brief Pads the current byte with zero bits and writes everything in the accumulator to the Stream.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        Boole AlignToByte();
+
+        /// @brief Gets the number of bits written.
+        /// @return Returns the total number of bits written, including padding added by AlignToByte.
+        [[nodiscard]] UInt64 GetBitsWritten() const;
+    };//BitStreamWriter
+
+    RESTORE_WARNING_STATE
+}//Mezzanine
+
+#endif
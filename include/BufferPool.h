@@ -0,0 +1,181 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_BufferPool_h
+#define Mezz_IOStreams_BufferPool_h
+
+/// @file
+/// @brief This file contains the process wide pool that Stream buffers are drawn from.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+
+    #include <cstddef>
+    #include <memory>
+#endif
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A process wide pool of recycled buffers for Streams.
+    /// @details Requests are rounded up to a power of two size class. Released buffers go to a small cache
+    /// owned by the releasing thread, so a thread that repeatedly opens and closes Streams reuses its own
+    /// buffers without taking a lock. When a thread cache is full, buffers go to a cache shared by all
+    /// threads. When that is full too, they are freed.
+    /// @n @n
+    /// Buffers larger than MaxPooledSize are allocated and freed directly.
+    ///////////////////////////////////////
+    class MEZZ_LIB BufferPool
+    {
+    public:
+        /// @brief The smallest size class. Smaller requests are rounded up to this.
+        static constexpr size_t MinPooledSize = 256;
+        /// @brief The largest size class. Larger requests are not pooled.
+        static constexpr size_t MaxPooledSize = 4 * 1024 * 1024;
+        /// @brief The number of size classes between MinPooledSize and MaxPooledSize.
+        static constexpr size_t ClassCount = 15;
+        /// @brief The largest size class cached per thread. Larger buffers only use the shared cache.
+        static constexpr size_t MaxThreadCachedSize = 64 * 1024;
+        /// @brief The number of buffers of each size class cached per thread.
+        static constexpr size_t ThreadCacheDepth = 8;
+        /// @brief The number of bytes of each size class kept in the shared cache.
+        static constexpr size_t SharedCacheBytes = 8 * 1024 * 1024;
+
+        /// @brief Deleter that returns a buffer to the pool.
+        struct Deleter
+        {
+            /// @brief The size the buffer was requested with.
+            size_t Size = 0;
+            /// @brief Returns a buffer to the pool.
+            /// @param Buffer The buffer to return.
+            void operator()(Char8* Buffer) const noexcept
+                { BufferPool::Deallocate(Buffer,this->Size); }
+        };//Deleter
+
+        /// @brief Convenience type for a pooled buffer that returns itself to the pool when destroyed.
+        using BufferPtr = std::unique_ptr<Char8[],Deleter>;
+
+        /// @brief Gets the number of bytes actually reserved for a request.
+        /// @param Size The requested size in bytes.
+        /// @return Returns the size class Size falls into, or Size if it is too large to be pooled.
+        [[nodiscard]] static size_t GetCapacity(const size_t Size) noexcept;
+
+        /// @brief Gets a buffer, reusing a released one if possible.
+        /// @remarks The returned buffer is suitably aligned for any fundamental type.
+        /// @param Size The minimum number of bytes needed. The contents are unspecified.
+        /// @return Returns a buffer of at least GetCapacity(Size) bytes.
+        [[nodiscard]] static Char8* Allocate(const size_t Size);
+        /// @brief Returns a buffer to the pool.
+        /// @param Buffer The buffer to return. May be null.
+        /// @param Size The size the buffer was requested with.
+        static void Deallocate(Char8* Buffer, const size_t Size) noexcept;
+        /// @brief Gets a buffer that returns itself to the pool when destroyed.
+        /// @param Size The minimum number of bytes needed. The contents are unspecified.
+        /// @return Returns a pooled buffer of at least GetCapacity(Size) bytes.
+        [[nodiscard]] static BufferPtr Acquire(const size_t Size);
+
+        /// @brief Gets the number of buffers cached by the calling thread.
+        /// @param Size A size in the size class to check.
+        /// @return Returns the number of buffers of that size class waiting in the calling thread's cache.
+        [[nodiscard]] static size_t GetThreadCachedCount(const size_t Size) noexcept;
+        /// @brief Gets the number of buffers cached for all threads.
+        /// @param Size A size in the size class to check.
+        /// @return Returns the number of buffers of that size class waiting in the shared cache.
+        [[nodiscard]] static size_t GetSharedCachedCount(const size_t Size);
+        /// @brief Frees every buffer cached by the calling thread and in the shared cache.
+        static void Trim();
+    };//BufferPool
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A standard allocator that draws from the BufferPool.
+    /// @details This is intended for small, frequently created objects such as the control blocks of shared
+    /// pointers to Streams.
+    /// @tparam Type The type of object to allocate.
+    ///////////////////////////////////////
+    template<typename Type>
+    class BufferPoolAllocator
+    {
+    public:
+        /// @brief The type of object to allocate.
+        using value_type = Type;
+
+        /// @brief Blank constructor.
+        BufferPoolAllocator() noexcept = default;
+        /// @brief Rebinding constructor.
+        template<typename OtherType>
+        BufferPoolAllocator(const BufferPoolAllocator<OtherType>&) noexcept
+            {  }
+
+        /// @brief Allocates storage for objects.
+        /// @param Count The number of objects to allocate storage for.
+        /// @return Returns a pointer to uninitialized storage.
+        [[nodiscard]] Type* allocate(const size_t Count)
+        {
+            static_assert(alignof(Type) <= alignof(std::max_align_t),"Over-aligned types cannot be pooled.");
+            return static_cast<Type*>( static_cast<void*>( BufferPool::Allocate(Count * sizeof(Type)) ) );
+        }
+        /// @brief Returns storage to the pool.
+        /// @param Storage The storage to return.
+        /// @param Count The number of objects the storage was allocated for.
+        void deallocate(Type* Storage, const size_t Count) noexcept
+            { BufferPool::Deallocate(static_cast<Char8*>( static_cast<void*>(Storage) ),Count * sizeof(Type)); }
+
+        /// @brief Equality comparison operator.
+        /// @return Returns true, all pool allocators share the same pool.
+        template<typename OtherType>
+        Boole operator==(const BufferPoolAllocator<OtherType>&) const noexcept
+            { return true; }
+        /// @brief Inequality comparison operator.
+        /// @return Returns false, all pool allocators share the same pool.
+        template<typename OtherType>
+        Boole operator!=(const BufferPoolAllocator<OtherType>&) const noexcept
+            { return false; }
+    };//BufferPoolAllocator
+
+    /// @brief Creates an object in a shared_ptr with the object and its control block drawn from the BufferPool.
+    /// @tparam Type The type of object to create.
+    /// @tparam ArgTypes The types of the arguments to construct the object with.
+    /// @param Args The arguments to construct the object with.
+    /// @return Returns a shared pointer to the new object.
+    template<typename Type, typename... ArgTypes>
+    [[nodiscard]] std::shared_ptr<Type> MakePooledShared(ArgTypes&&... Args)
+        { return std::allocate_shared<Type>(BufferPoolAllocator<Type>(),std::forward<ArgTypes>(Args)...); }
+}//Mezzanine
+
+#endif
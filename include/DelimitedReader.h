@@ -0,0 +1,115 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_DelimitedReader_h
+#define Mezz_IOStreams_DelimitedReader_h
+
+#ifndef SWIG
+    #include "InputStream.h"
+
+    #include <vector>
+#endif
+
+namespace Mezzanine
+{
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An input Stream helper that splits delimited text into records and fields.
+    /// @details Records end at a newline, with an optional carriage return before it. Fields are separated by the
+    /// delimiter. A field that starts with the quote character may contain delimiters and newlines, and a doubled
+    /// quote inside it stands for a single quote. The text is classified 64 bytes at a time using SSE2, AVX2 or
+    /// NEON comparisons turned into bitmasks, with a scalar fallback.
+    ///////////////////////////////////////
+    class MEZZ_LIB DelimitedReader
+    {
+    protected:
+        /// @brief A pointer to the Stream being read from.
+        StdInputStreamPtr Stream;
+        /// @brief The reusable buffer for records that cross the end of the Stream buffer.
+        String RecordScratch;
+        /// @brief The reusable buffer for quoted fields that need their doubled quotes removed.
+        String FieldScratch;
+        /// @brief The character separating fields.
+        Char8 Delim;
+        /// @brief The character that quotes fields.
+        Char8 Quote;
+
+        /// @brief Reads the next record from the Stream.
+        /// @param Record Set to a view of the record, without the newline that ended it.
+        /// @return Returns true if a record was read, false if the Stream was at its end.
+        Boole FindRecord(StringView& Record);
+        /// @brief Splits a record into fields.
+        /// @param Record The record to split.
+        /// @param Fields The vector to populate with the fields of the record.
+        void SplitRecord(const StringView Record, std::vector<StringView>& Fields);
+    public:
+        /// @brief Stream constructor.
+        /// @param Input The Stream to read from.
+        /// @param Delimiter The character separating fields.
+        /// @param QuoteChar The character that quotes fields.
+        DelimitedReader(StdInputStreamPtr Input, const Char8 Delimiter = ',', const Char8 QuoteChar = '"');
+        /// @brief Class destructor.
+        ~DelimitedReader() = default;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Reading
+
+        /// @brief Reads the next record and splits it into fields.
+        /// @remarks Fields point into the buffer of the Stream when the whole record is buffered and no quotes need
+        /// removing, and into buffers owned by this reader otherwise. Either way they are only valid until the next
+        /// operation on this reader or the Stream.
+        /// @param Fields Cleared and then populated with the fields of the record. Reusing the same vector for every
+        /// record avoids allocating.
+        /// @return Returns true if a record was read, or false if the Stream was already at its end or not valid.
+        Boole ReadRecord(std::vector<StringView>& Fields);
+
+        /// @brief Gets the character separating fields.
+        /// @return Returns the delimiter this reader splits fields on.
+        [[nodiscard]] Char8 GetDelimiter() const noexcept;
+        /// @brief Gets the character that quotes fields.
+        /// @return Returns the quote character this reader recognizes.
+        [[nodiscard]] Char8 GetQuote() const noexcept;
+    };//DelimitedReader
+
+    RESTORE_WARNING_STATE
+}//Mezzanine
+
+#endif
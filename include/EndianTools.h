@@ -0,0 +1,186 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_EndianTools_h
+#define Mezz_IOStreams_EndianTools_h
+
+/// @file
+/// @brief This file contains utilities for converting data between byte orders.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+
+    #include <algorithm>
+    #include <array>
+    #include <cstring>
+    #include <tuple>
+    #include <type_traits>
+    #include <utility>
+#endif
+
+namespace Mezzanine
+{
+    /// @brief An enum describing the order of the bytes in a multi-byte value.
+    enum class ByteOrder
+    {
+        Little,  ///< The least significant byte comes first. Used by x86 and most ARM platforms.
+        Big,     ///< The most significant byte comes first. Also known as network byte order.
+    #if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        Native = Big     ///< The byte order of the platform being compiled for.
+    #else
+        Native = Little  ///< The byte order of the platform being compiled for.
+    #endif
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A collection of functions for converting data between byte orders.
+    ///////////////////////////////////////
+    namespace EndianTools
+    {
+        /// @brief Gets whether or not data in a byte order needs to be swapped to be used on this platform.
+        /// @param Order The byte order of the data.
+        /// @return Returns true if Order is not the native byte order, false otherwise.
+        [[nodiscard]] constexpr Boole NeedsSwap(const ByteOrder Order) noexcept
+            { return Order != ByteOrder::Native; }
+
+        /// @brief Reverses the order of the bytes in a value.
+        /// @tparam Datum The standard arithmetic type to swap.
+        /// @param Value The value to swap.
+        /// @return Returns Value with its bytes reversed.
+        template<typename Datum, typename = std::enable_if_t< std::is_arithmetic_v<Datum> >>
+        [[nodiscard]] Datum ByteSwap(const Datum Value) noexcept
+        {
+            // Compilers recognize this pattern and emit a single byte swap instruction where one exists.
+            UInt8 Bytes[sizeof(Datum)];
+            std::memcpy(Bytes,&Value,sizeof(Datum));
+            std::reverse(Bytes,Bytes + sizeof(Datum));
+            Datum Ret;
+            std::memcpy(&Ret,Bytes,sizeof(Datum));
+            return Ret;
+        }
+        /// @brief Converts a value between the native byte order and another byte order.
+        /// @remarks The conversion is the same in both directions.
+        /// @tparam Datum The standard arithmetic type to convert.
+        /// @param Value The value to convert.
+        /// @param Order The byte order to convert to or from.
+        /// @return Returns Value swapped if Order is not native, or Value unchanged otherwise.
+        template<typename Datum, typename = std::enable_if_t< std::is_arithmetic_v<Datum> >>
+        [[nodiscard]] Datum ConvertByteOrder(const Datum Value, const ByteOrder Order) noexcept
+            { return ( NeedsSwap(Order) ? ByteSwap(Value) : Value ); }
+
+        /// @brief Copies an array of elements, reversing the bytes of each element.
+        /// @remarks Uses SSSE3, AVX2 or NEON byte shuffles when the build targets them, and a scalar loop
+        /// otherwise. Source and Dest may be the same array to swap in place, but must not otherwise overlap.
+        /// @param Dest The array to write the swapped elements to.
+        /// @param Source The array of elements to swap.
+        /// @param Count The number of elements in the array.
+        /// @param ElementSize The size of each element in bytes. Must be no more than 16.
+        MEZZ_LIB void ByteSwapCopy(void* Dest, const void* Source, const size_t Count, const size_t ElementSize) noexcept;
+        /// @brief Converts an array in place between the native byte order and another byte order.
+        /// @tparam Datum The standard arithmetic type of the elements.
+        /// @param Values The array to convert.
+        /// @param Count The number of elements in the array.
+        /// @param Order The byte order to convert to or from.
+        template<typename Datum, typename = std::enable_if_t< std::is_arithmetic_v<Datum> >>
+        void ConvertArray(Datum* Values, const size_t Count, const ByteOrder Order) noexcept
+        {
+            if constexpr( sizeof(Datum) > 1 ) {
+                if( NeedsSwap(Order) ) {
+                    ByteSwapCopy(Values,Values,Count,sizeof(Datum));
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Packed Records
+
+        /// @brief The number of bytes a set of values occupies when stored back to back without padding.
+        /// @tparam Data The standard arithmetic types of the values.
+        template<typename... Data>
+        constexpr size_t PackedSize = ( sizeof(Data) + ... + 0 );
+
+        /// @brief Gets where each of a set of values begins when stored back to back without padding.
+        /// @tparam Data The standard arithmetic types of the values.
+        /// @return Returns an array with the byte offset of each value.
+        template<typename... Data>
+        [[nodiscard]] constexpr std::array<size_t,sizeof...(Data)> PackedOffsets() noexcept
+        {
+            constexpr size_t Sizes[] = { sizeof(Data)..., 0 };
+            std::array<size_t,sizeof...(Data)> Offsets{};
+            size_t Offset = 0;
+            for( size_t Index = 0 ; Index < sizeof...(Data) ; ++Index )
+            {
+                Offsets[Index] = Offset;
+                Offset += Sizes[Index];
+            }
+            return Offsets;
+        }
+
+        /// @brief Unpacks a tuple of values stored back to back without padding.
+        /// @tparam Data The standard arithmetic types of the values.
+        /// @param Packed The buffer holding the values. Must be at least PackedSize<Data...> in size.
+        /// @param Order The byte order the values are stored in.
+        /// @return Returns a tuple of the unpacked values.
+        template<typename... Data, size_t... Indexes>
+        [[nodiscard]] std::tuple<Data...> UnpackTuple(const char* Packed, const ByteOrder Order,
+                                                      std::index_sequence<Indexes...>) noexcept
+        {
+            constexpr std::array<size_t,sizeof...(Data)> Offsets = PackedOffsets<Data...>();
+            std::tuple<Data...> Values;
+            ( std::memcpy(&std::get<Indexes>(Values),Packed + Offsets[Indexes],sizeof(Data)), ... );
+            ( ( std::get<Indexes>(Values) = ConvertByteOrder(std::get<Indexes>(Values),Order) ), ... );
+            return Values;
+        }
+        /// @brief Packs a tuple of values back to back without padding.
+        /// @tparam Data The standard arithmetic types of the values.
+        /// @param Packed The buffer to store the values in. Must be at least PackedSize<Data...> in size.
+        /// @param Values The values to pack.
+        /// @param Order The byte order to store the values in.
+        template<typename... Data, size_t... Indexes>
+        void PackTuple(char* Packed, const std::tuple<Data...>& Values, const ByteOrder Order,
+                       std::index_sequence<Indexes...>) noexcept
+        {
+            constexpr std::array<size_t,sizeof...(Data)> Offsets = PackedOffsets<Data...>();
+            const std::tuple<Data...> Converted( ConvertByteOrder(std::get<Indexes>(Values),Order)... );
+            ( std::memcpy(Packed + Offsets[Indexes],&std::get<Indexes>(Converted),sizeof(Data)), ... );
+        }
+    }//EndianTools
+}//Mezzanine
+
+#endif
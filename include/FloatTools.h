@@ -0,0 +1,118 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_FloatTools_h
+#define Mezz_IOStreams_FloatTools_h
+
+/// @file
+/// @brief This file contains utilities for storing floating point values in fewer bytes.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+#endif
+
+namespace Mezzanine
+{
+    /// @brief An enum describing how floating point values are stored.
+    enum class FloatEncoding : UInt8
+    {
+        Float32,  ///< Full precision 32-bit IEEE floats.
+        Half,     ///< 16-bit IEEE half precision floats.
+        SNorm8,   ///< Values in the range [-1,1] mapped to signed 8-bit integers.
+        UNorm8,   ///< Values in the range [0,1] mapped to unsigned 8-bit integers.
+        SNorm16,  ///< Values in the range [-1,1] mapped to signed 16-bit integers.
+        UNorm16   ///< Values in the range [0,1] mapped to unsigned 16-bit integers.
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A collection of functions for converting floats to and from smaller encodings.
+    /// @details Half floats keep the sign and about three significant digits over a range of roughly
+    /// 6e-8 to 65504. The normalized encodings clamp values to their range, round to the nearest step, and
+    /// encode NaN as zero. Signed normalized values decode with both the smallest and the next smallest
+    /// integer mapping to -1, so that 0 and the range ends are represented exactly.
+    ///////////////////////////////////////
+    namespace FloatTools
+    {
+        /// @brief Gets the number of bytes each value takes in an encoding.
+        /// @param Encoding The encoding to get the size of.
+        /// @return Returns the size of a single encoded value in bytes.
+        [[nodiscard]] constexpr size_t GetEncodedSize(const FloatEncoding Encoding) noexcept
+        {
+            switch( Encoding )
+            {
+                case FloatEncoding::Float32:  return 4;
+                case FloatEncoding::Half:     return 2;
+                case FloatEncoding::SNorm8:   return 1;
+                case FloatEncoding::UNorm8:   return 1;
+                case FloatEncoding::SNorm16:  return 2;
+                case FloatEncoding::UNorm16:  return 2;
+            }
+            return 0;
+        }
+
+        /// @brief Converts a float to a half float, rounding to the nearest representable value.
+        /// @param Value The float to convert.
+        /// @return Returns the bits of the half float.
+        [[nodiscard]] MEZZ_LIB UInt16 FloatToHalf(const float Value) noexcept;
+        /// @brief Converts a half float to a float.
+        /// @remarks Every half float is exactly representable as a float.
+        /// @param Half The bits of the half float to convert.
+        /// @return Returns the converted float.
+        [[nodiscard]] MEZZ_LIB float HalfToFloat(const UInt16 Half) noexcept;
+
+        /// @brief Encodes an array of floats.
+        /// @remarks Half floats are converted with F16C or NEON instructions when the build targets them, and
+        /// a scalar loop otherwise. The encoded values are in the native byte order.
+        /// @param In The floats to encode.
+        /// @param Count The number of floats.
+        /// @param Encoding The encoding to use.
+        /// @param Out The buffer to write to. Must have room for Count * GetEncodedSize(Encoding) bytes.
+        MEZZ_LIB void EncodeFloats(const float* In, const size_t Count, const FloatEncoding Encoding, void* Out) noexcept;
+        /// @brief Decodes an array of floats.
+        /// @remarks Uses the same hardware conversions as EncodeFloats when they are available. The encoded
+        /// values must be in the native byte order.
+        /// @param In The encoded values.
+        /// @param Count The number of values.
+        /// @param Encoding The encoding the values are stored in.
+        /// @param Out The array to write the floats to.
+        MEZZ_LIB void DecodeFloats(const void* In, const size_t Count, const FloatEncoding Encoding, float* Out) noexcept;
+    }//FloatTools
+}//Mezzanine
+
+#endif
@@ -55,6 +55,11 @@ namespace Mezzanine
     ///////////////////////////////////////
     class InputOutputStream : public InputStreamBase, public OutputStreamBase, public std::iostream
     {
+    protected:
+        /// @brief Storage for viewed data that isn't contiguous in the buffer of this Stream.
+        std::vector<Char8> ViewBuffer;
+        /// @brief Mutex serializing reads at explicit positions, since they have to move the shared cursor.
+        std::mutex PositionLock;
     public:
         /// @brief Class constructor.
         /// @param Buf A pointer to the buffer that will be streamed.
@@ -81,9 +86,24 @@ namespace Mezzanine
 
         /// @copydoc InputStream::Read(void*, StreamSize)
         virtual size_t Read(void* Buffer, const StreamSize Size);
+        /// @copydoc InputStream::ReadV(const StreamReadSegment*, const size_t)
+        virtual StreamSize ReadV(const StreamReadSegment* Segments, const size_t Count);
         /// @copydoc InputStream::ReadLine(Char8*, const StreamSize, const Char8)
         virtual size_t ReadLine(Char8* Buffer, const StreamSize Size, const Char8 Delim = '\n');
 
+        /// @copydoc InputStream::Peek(const StreamSize)
+        [[nodiscard]] virtual StringView Peek(const StreamSize Size);
+        /// @copydoc InputStream::Acquire(const StreamSize)
+        [[nodiscard]] virtual StringView Acquire(const StreamSize Size);
+        /// @copydoc InputStream::Consume(const StreamSize)
+        virtual StreamSize Consume(const StreamSize Size);
+        /// @copydoc InputStream::ReadAt(const StreamPos, void*, const StreamSize)
+        virtual StreamSize ReadAt(const StreamPos Position, void* Buffer, const StreamSize Size);
+        /// @copydoc InputStream::ReadAsync(const StreamPos, void*, const StreamSize)
+        [[nodiscard]] virtual std::future<StreamSize> ReadAsync(const StreamPos Position,
+                                                                void* Buffer,
+                                                                const StreamSize Size);
+
         /// @copydoc InputStream::SetReadPosition(StreamPos)
         virtual void SetReadPosition(StreamPos Position);
         /// @copydoc InputStream::SetReadPosition(StreamOff, SeekOrigin)
@@ -99,6 +119,8 @@ namespace Mezzanine
 
         /// @copydoc OutputStream::Write(const void*, StreamSize)
         virtual Boole Write(const void* Buffer, StreamSize Size);
+        /// @copydoc OutputStream::WriteV(const StreamWriteSegment*, const size_t)
+        virtual Boole WriteV(const StreamWriteSegment* Segments, const size_t Count);
 
         /// @copydoc OutputStream::SetWritePosition(StreamPos)
         virtual void SetWritePosition(StreamPos Position);
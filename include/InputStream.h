@@ -42,6 +42,8 @@
 
 #ifndef SWIG
     #include "StreamBase.h"
+
+    #include <mutex>
 #endif
 
 namespace Mezzanine
@@ -54,6 +56,11 @@ namespace Mezzanine
     ///////////////////////////////////////
     class InputStream : public InputStreamBase, public std::istream
     {
+    protected:
+        /// @brief Storage for viewed data that isn't contiguous in the buffer of this Stream.
+        std::vector<Char8> ViewBuffer;
+        /// @brief Mutex serializing reads at explicit positions, since they have to move the shared cursor.
+        std::mutex PositionLock;
     public:
         /// @brief Class constructor.
         /// @param Buf A pointer to the buffer that will be streamed.
@@ -80,9 +87,28 @@ namespace Mezzanine
 
         /// @copydoc InputStreamBase::Read(void*, const StreamSize)
         virtual size_t Read(void* Buffer, const StreamSize Size);
+        /// @copydoc InputStreamBase::ReadV(const StreamReadSegment*, const size_t)
+        virtual StreamSize ReadV(const StreamReadSegment* Segments, const size_t Count);
         /// @copydoc InputStreamBase::ReadLine(Char8*, const StreamSize, const Char8)
         virtual size_t ReadLine(Char8* Buffer, const StreamSize Size, const Char8 Delim = '\n');
 
+        /// @copydoc InputStreamBase::Peek(const StreamSize)
+        [[nodiscard]] virtual StringView Peek(const StreamSize Size);
+        /// @copydoc InputStreamBase::Acquire(const StreamSize)
+        [[nodiscard]] virtual StringView Acquire(const StreamSize Size);
+        /// @copydoc InputStreamBase::Consume(const StreamSize)
+        virtual StreamSize Consume(const StreamSize Size);
+        /// @copydoc InputStreamBase::ReadAt(const StreamPos, void*, const StreamSize)
+        /// @remarks This generic version seeks the shared cursor, reads, and seeks back. Calls to it are
+        /// serialized with each other, but not with any other use of the Stream, so while one is in flight on
+        /// another thread the Stream must not otherwise be used. Streams that can read at a position without the
+        /// cursor override this.
+        virtual StreamSize ReadAt(const StreamPos Position, void* Buffer, const StreamSize Size);
+        /// @copydoc InputStreamBase::ReadAsync(const StreamPos, void*, const StreamSize)
+        [[nodiscard]] virtual std::future<StreamSize> ReadAsync(const StreamPos Position,
+                                                                void* Buffer,
+                                                                const StreamSize Size);
+
         /// @copydoc InputStreamBase::SetReadPosition(StreamPos)
         virtual void SetReadPosition(StreamPos Position);
         /// @copydoc InputStreamBase::SetReadPosition(StreamOff, SeekOrigin)
@@ -0,0 +1,219 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_MemoryMappedStream_h
+#define Mezz_IOStreams_MemoryMappedStream_h
+
+/// @file
+/// @brief This file contains the streambuf and Stream classes for reading files via memory mapping.
+
+#ifndef SWIG
+    #include "InputStream.h"
+#endif
+
+namespace Mezzanine
+{
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+    SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A read-only streambuf that exposes an entire memory mapped file as its get area.
+    /// @details Since the whole file is visible to the streambuf at once, reads are a copy out of the mapping
+    /// and seeks are pointer arithmetic. Underflow never needs to go to the OS for more data, the OS pages the
+    /// file in as it is touched instead.
+    ///////////////////////////////////////
+    class MEZZ_LIB MemoryMappedBuffer : public std::streambuf
+    {
+    protected:
+        /// @brief The name of the file that is currently mapped.
+        String FileName;
+        /// @brief A pointer to the start of the mapped file, or nullptr if nothing is mapped.
+        Char8* MappedData = nullptr;
+        /// @brief The size of the mapped file in bytes.
+        StreamSize MappedSize = 0;
+        #ifdef _WIN32
+        /// @brief The handle to the file that was opened for the mapping.
+        void* FileHandle = nullptr;
+        /// @brief The handle to the file mapping object.
+        void* MappingHandle = nullptr;
+        #endif
+        /// @brief Whether or not a file is currently open.
+        Boole Opened = false;
+
+        /// @brief Checks that a position is within the mapped file and updates the get area to it.
+        /// @param Position The absolute position to move to.
+        /// @return Returns the new position, or an invalid position if the requested position was out of range.
+        StreamPos MoveGetPointer(const StreamOff Position);
+    public:
+        /// @brief Blank constructor.
+        MemoryMappedBuffer() = default;
+        /// @brief Copy constructor.
+        /// @param Other The other buffer to not be copied.
+        MemoryMappedBuffer(const MemoryMappedBuffer& Other) = delete;
+        /// @brief Move constructor.
+        /// @param Other The other buffer to not be moved.
+        MemoryMappedBuffer(MemoryMappedBuffer&& Other) = delete;
+        /// @brief Class destructor.
+        virtual ~MemoryMappedBuffer();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Operators
+
+        /// @brief Copy assignment operator.
+        /// @param Other The other buffer to not be copied.
+        /// @return Returns a reference to this.
+        MemoryMappedBuffer& operator=(const MemoryMappedBuffer& Other) = delete;
+        /// @brief Move assignment operator.
+        /// @param Other The other buffer to not be moved.
+        /// @return Returns a reference to this.
+        MemoryMappedBuffer& operator=(MemoryMappedBuffer&& Other) = delete;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Mapping
+
+        /// @brief Maps a file into memory for reading.
+        /// @remarks If a file is already open it will be closed first. Empty files can be opened, but have
+        /// no mapping and will report EoF immediately.
+        /// @param File The name of the file to map.
+        /// @return Returns true if the file was successfully opened and mapped, false otherwise.
+        Boole Open(const String& File);
+        /// @brief Unmaps and closes the current file.
+        /// @remarks Any pointers previously returned by GetData() are invalid after this is called.
+        void Close();
+        /// @brief Gets whether or not a file is open.
+        /// @return Returns true if a file was successfully opened and hasn't been closed, false otherwise.
+        [[nodiscard]] Boole IsOpen() const noexcept;
+
+        /// @brief Gets the name of the file that is mapped.
+        /// @return Returns a const reference to the name of the mapped file.
+        [[nodiscard]] const String& GetFileName() const noexcept;
+        /// @brief Gets the start of the mapped file.
+        /// @return Returns a pointer to the first byte of the file, or nullptr if no file is mapped.
+        [[nodiscard]] const Char8* GetData() const noexcept;
+        /// @brief Gets the size of the mapped file.
+        /// @return Returns the number of bytes in the mapped file.
+        [[nodiscard]] StreamSize GetSize() const noexcept;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Internal Buffer Operations
+
+        /// @copydoc std::streambuf::seekoff(off_type,std::ios_base::seekdir,std::ios_base::openmode)
+        pos_type seekoff(off_type Offset, std::ios_base::seekdir Origin, std::ios_base::openmode Mode) override;
+        /// @copydoc std::streambuf::seekpos(pos_type,std::ios_base::openmode)
+        pos_type seekpos(pos_type Position, std::ios_base::openmode Mode) override;
+        /// @copydoc std::streambuf::showmanyc()
+        std::streamsize showmanyc() override;
+        /// @copydoc std::streambuf::xsgetn(char_type*,std::streamsize)
+        std::streamsize xsgetn(char_type* Buffer, std::streamsize Count) override;
+    };//MemoryMappedBuffer
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An input Stream that reads a file by mapping it into memory.
+    /// @details This Stream avoids the copy from the OS into an intermediate buffer that a std::filebuf performs
+    /// on every underflow. The whole file is addressable at once, so GetSize() is constant time and seeking never
+    /// performs I/O.
+    ///////////////////////////////////////
+    class MEZZ_LIB MemoryMappedInputStream : public InputStream
+    {
+    protected:
+        /// @brief The buffer doing the actual mapping for this Stream.
+        MemoryMappedBuffer MappedBuffer;
+    public:
+        /// @brief Blank constructor.
+        MemoryMappedInputStream();
+        /// @brief File constructor.
+        /// @remarks If the file fails to open the Stream will have it's fail bit set.
+        /// @param File The name of the file to map.
+        MemoryMappedInputStream(const String& File);
+        /// @brief Class destructor.
+        virtual ~MemoryMappedInputStream() = default;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // File Operations
+
+        /// @brief Maps a file into memory for reading.
+        /// @remarks If a file is already open it will be closed first. On failure the fail bit will be set.
+        /// @param File The name of the file to map.
+        void OpenFile(const String& File);
+        /// @brief Unmaps and closes the current file.
+        void CloseFile();
+        /// @brief Gets whether or not a file is open.
+        /// @return Returns true if a file is currently mapped by this Stream, false otherwise.
+        [[nodiscard]] Boole IsOpen() const noexcept;
+
+        /// @brief Gets the start of the mapped file.
+        /// @remarks This pointer is valid until the file is closed. It can be used to look at the file contents
+        /// without copying them out of the Stream.
+        /// @return Returns a pointer to the first byte of the file, or nullptr if no file is mapped.
+        [[nodiscard]] const Char8* GetData() const noexcept;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Input Functions
+
+        /// @copydoc InputStreamBase::ReadAt(const StreamPos, void*, const StreamSize)
+        /// @remarks This copies directly out of the mapping without touching the read position or taking any
+        /// locks, so any number of threads can read from this Stream at once.
+        virtual StreamSize ReadAt(const StreamPos Position, void* Buffer, const StreamSize Size);
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Stream Base Operations
+
+        /// @copydoc StreamBase::GetIdentifier() const
+        [[nodiscard]] virtual String GetIdentifier() const;
+        /// @copydoc StreamBase::GetGroup() const
+        [[nodiscard]] virtual String GetGroup() const;
+
+        /// @copydoc StreamBase::GetSize() const
+        [[nodiscard]] virtual StreamSize GetSize() const;
+        /// @copydoc StreamBase::CanSeek() const
+        [[nodiscard]] virtual Boole CanSeek() const;
+        /// @copydoc StreamBase::IsEncrypted() const
+        [[nodiscard]] virtual Boole IsEncrypted() const;
+        /// @copydoc StreamBase::IsRaw() const
+        [[nodiscard]] virtual Boole IsRaw() const;
+    };//MemoryMappedInputStream
+
+    RESTORE_WARNING_STATE
+
+    /// @brief Convenience type for a memory mapped input stream in a shared_ptr.
+    using MemoryMappedInputStreamPtr = std::shared_ptr<MemoryMappedInputStream>;
+}//Mezzanine
+
+#endif
@@ -80,6 +80,8 @@ namespace Mezzanine
 
         /// @copydoc OutputStreamBase::Write(const void*, StreamSize)
         virtual Boole Write(const void* Buffer, StreamSize Size);
+        /// @copydoc OutputStreamBase::WriteV(const StreamWriteSegment*, const size_t)
+        virtual Boole WriteV(const StreamWriteSegment* Segments, const size_t Count);
 
         /// @copydoc OutputStreamBase::SetWritePosition(StreamPos)
         virtual void SetWritePosition(StreamPos Position);
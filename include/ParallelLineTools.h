@@ -0,0 +1,123 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_ParallelLineTools_h
+#define Mezz_IOStreams_ParallelLineTools_h
+
+/// @file
+/// @brief This file contains utilities for processing the lines of a large Stream on several threads.
+
+#ifndef SWIG
+    #include "AsyncReadQueue.h"
+    #include "RangeStream.h"
+    #include "TextStreamReader.h"
+
+    #include <optional>
+    #include <type_traits>
+#endif
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A collection of functions for splitting a Stream of lines into ranges that can be processed in parallel.
+    /// @details Ranges always start at the beginning of a line and end just after a delimiter or at the end of the
+    /// Stream, so no line is ever split between two ranges.
+    ///////////////////////////////////////
+    namespace ParallelLineTools
+    {
+        /// @brief Splits a Stream into ranges of roughly equal size that only contain whole lines.
+        /// @remarks Fewer ranges than requested are returned if the Stream has too few lines to fill them.
+        /// @exception If the Stream can't seek, a StreamReadError will be thrown.
+        /// @param Source The Stream to split.
+        /// @param RangeCount The number of ranges to aim for.
+        /// @param Delim The character that ends each line.
+        /// @return Returns the ranges, in order, covering the whole Stream.
+        [[nodiscard]] MEZZ_LIB std::vector<StreamRange> SplitLines(InputStreamBase& Source,
+                                                                   const size_t RangeCount,
+                                                                   const Char8 Delim = '\n');
+
+        /// @brief Processes the lines of a Stream on several threads and collects the results in order.
+        /// @remarks The Stream is split with SplitLines and each range is given to Work as its own reader, on the
+        /// threads of Queue. Work is called concurrently and must be safe to call that way. If any call to Work
+        /// throws, the first exception is rethrown once every range has finished. @n @n
+        /// This blocks until all ranges are processed, so it must not be called from a task running on Queue.
+        /// @tparam Worker A callable taking a TextStreamReader& and returning a result for its range.
+        /// @param Source The Stream to process. Only positional reads are used on it.
+        /// @param RangeCount The number of ranges to aim for. Usually the number of threads in Queue.
+        /// @param Work The function that processes the lines of one range.
+        /// @param Delim The character that ends each line.
+        /// @param Queue The queue whose threads run Work.
+        /// @return Returns the result of Work for each range, in the order the ranges appear in the Stream.
+        template<typename Worker>
+        [[nodiscard]] std::vector< std::invoke_result_t<Worker&,TextStreamReader&> >
+            ProcessLines(InputStreamBase& Source,
+                         const size_t RangeCount,
+                         Worker Work,
+                         const Char8 Delim = '\n',
+                         AsyncReadQueue& Queue = AsyncReadQueue::GetDefault())
+        {
+            using ResultType = std::invoke_result_t<Worker&,TextStreamReader&>;
+            const std::vector<StreamRange> Ranges = SplitLines(Source,RangeCount,Delim);
+            std::vector< std::optional<ResultType> > Results(Ranges.size());
+            std::vector< std::future<StreamSize> > Pending;
+            Pending.reserve(Ranges.size());
+            for( size_t Index = 0 ; Index < Ranges.size() ; ++Index )
+            {
+                Pending.push_back( Queue.Submit([&Source,&Ranges,&Results,&Work,Index]() {
+                    TextStreamReader Reader( std::make_shared<RangeInputStream>(Source,Ranges[Index]) );
+                    Results[Index].emplace( Work(Reader) );
+                    return Ranges[Index].Size;
+                }) );
+            }
+            // Every task references these locals, so let all of them finish before anything can throw.
+            for( std::future<StreamSize>& Task : Pending )
+                { Task.wait(); }
+            for( std::future<StreamSize>& Task : Pending )
+                { Task.get(); }
+
+            std::vector<ResultType> Combined;
+            Combined.reserve(Results.size());
+            for( std::optional<ResultType>& Result : Results )
+                { Combined.push_back( std::move(*Result) ); }
+            return Combined;
+        }
+    }//ParallelLineTools
+}//Mezzanine
+
+#endif
@@ -0,0 +1,326 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_PipeStream_h
+#define Mezz_IOStreams_PipeStream_h
+
+/// @file
+/// @brief This file contains the Stream classes for passing data from one thread to another.
+
+#ifndef SWIG
+    #include "BufferPool.h"
+    #include "InputStream.h"
+    #include "OutputStream.h"
+
+    #include <atomic>
+    #include <condition_variable>
+#endif
+
+namespace Mezzanine
+{
+    /// @brief An enum describing what a pipe does when it has to wait on the other end.
+    enum class PipeWaitPolicy
+    {
+        Spin,  ///< Busy wait, yielding the thread between checks. Lowest latency, but occupies a core while waiting.
+        Block  ///< Spin briefly, then sleep until the other end signals. Best when waits may be long.
+    };
+
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+    SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+    SUPPRESS_VC_WARNING(4324)
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A lock-free single producer, single consumer ring buffer shared by the two ends of a pipe.
+    /// @details The read and write positions are only ever increased, each by only one thread, and are kept on
+    /// separate cache lines so the two threads don't contend over them. Neither end takes a lock unless it has
+    /// to sleep under the Block wait policy.
+    /// @n @n
+    /// Exactly one thread may write and exactly one thread may read at a time.
+    ///////////////////////////////////////
+    class MEZZ_LIB PipeRing
+    {
+    public:
+        /// @brief The assumed size of a cache line, used to separate data written by each end.
+        static constexpr size_t CacheLineSize = 64;
+        /// @brief The capacity used when no other capacity is specified.
+        static constexpr size_t DefaultCapacity = 64 * 1024;
+    protected:
+        /// @brief The total number of bytes ever written, only changed by the writer.
+        alignas(CacheLineSize) std::atomic<size_t> WritePosition{0};
+        /// @brief The total number of bytes ever read, only changed by the reader.
+        alignas(CacheLineSize) std::atomic<size_t> ReadPosition{0};
+        /// @brief Whether or not the write end of the pipe has been closed.
+        alignas(CacheLineSize) std::atomic<Boole> WriterClosed{false};
+        /// @brief Whether or not the read end of the pipe has been closed.
+        std::atomic<Boole> ReaderClosed{false};
+        /// @brief The number of threads sleeping on the WaitCondition.
+        std::atomic<UInt32> Waiters{0};
+        /// @brief Mutex used only for sleeping under the Block wait policy.
+        std::mutex WaitLock;
+        /// @brief Condition used only for sleeping under the Block wait policy.
+        std::condition_variable WaitCondition;
+        /// @brief The storage for the ring.
+        std::vector<Char8> Data;
+        /// @brief The number of bytes the ring can hold.
+        size_t Capacity;
+        /// @brief Bitmask used to convert a position to an index in the ring.
+        size_t Mask;
+        /// @brief What to do when one end has to wait on the other.
+        PipeWaitPolicy WaitPolicy;
+
+        /// @brief Waits until a condition is met according to the wait policy.
+        /// @param Condition A callable returning true when waiting can stop.
+        template<typename Predicate>
+        void WaitUntil(Predicate Condition);
+        /// @brief Wakes the other end if it is sleeping.
+        void Notify();
+    public:
+        /// @brief Class constructor.
+        /// @param MinCapacity The minimum number of bytes the ring can hold. Rounded up to a power of two.
+        /// @param Policy What to do when one end has to wait on the other.
+        PipeRing(const size_t MinCapacity, const PipeWaitPolicy Policy);
+        /// @brief Class destructor.
+        ~PipeRing() = default;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Query
+
+        /// @brief Gets the number of bytes the ring can hold.
+        /// @return Returns the capacity of the ring.
+        [[nodiscard]] size_t GetCapacity() const noexcept;
+        /// @brief Gets what happens when one end has to wait on the other.
+        /// @return Returns the wait policy of the ring.
+        [[nodiscard]] PipeWaitPolicy GetWaitPolicy() const noexcept;
+        /// @brief Gets the number of bytes written but not yet read.
+        /// @return Returns the number of bytes in the ring.
+        [[nodiscard]] size_t GetBufferedSize() const noexcept;
+        /// @brief Gets whether or not the write end of the pipe has been closed.
+        /// @return Returns true if the writer will not write any more data, false otherwise.
+        [[nodiscard]] Boole IsWriterClosed() const noexcept;
+        /// @brief Gets whether or not the read end of the pipe has been closed.
+        /// @return Returns true if the reader will not read any more data, false otherwise.
+        [[nodiscard]] Boole IsReaderClosed() const noexcept;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Writer Interface
+
+        /// @brief Gets the next contiguous free region of the ring.
+        /// @param Start Set to the start of the free region.
+        /// @return Returns the number of bytes that can be written at Start.
+        size_t GetWritable(Char8*& Start) noexcept;
+        /// @brief Waits until there is space to write in the ring.
+        /// @return Returns true if there is space, or false if the read end has been closed.
+        Boole WaitForSpace();
+        /// @brief Makes written bytes visible to the reader.
+        /// @param Count The number of bytes written to the free region.
+        void CommitWrite(const size_t Count);
+        /// @brief Closes the write end of the pipe. The reader will see EoF once the ring is empty.
+        void CloseWriter();
+        /// @brief Gets the total number of bytes committed by the writer.
+        /// @return Returns the write position of the pipe.
+        [[nodiscard]] size_t GetWritePosition() const noexcept;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Reader Interface
+
+        /// @brief Gets the next contiguous region of unread data in the ring.
+        /// @param Start Set to the start of the unread data.
+        /// @return Returns the number of bytes that can be read at Start.
+        size_t GetReadable(Char8*& Start) noexcept;
+        /// @brief Waits until there is data to read in the ring.
+        /// @return Returns true if there is data, or false if the ring is empty and the write end has been closed.
+        Boole WaitForData();
+        /// @brief Releases read bytes back to the writer.
+        /// @param Count The number of bytes read from the unread data.
+        void CommitRead(const size_t Count);
+        /// @brief Closes the read end of the pipe. The writer will fail to write any further data.
+        void CloseReader();
+        /// @brief Gets the total number of bytes released by the reader.
+        /// @return Returns the read position of the pipe.
+        [[nodiscard]] size_t GetReadPosition() const noexcept;
+    };//PipeRing
+
+    /// @brief Convenience type for a ring shared by both ends of a pipe.
+    using PipeRingPtr = std::shared_ptr<PipeRing>;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief The streambuf for the read end of a pipe.
+    /// @details The get area is the unread data in the ring itself, so nothing is copied on the read side until
+    /// the data is read out of the Stream.
+    ///////////////////////////////////////
+    class MEZZ_LIB PipeInputBuffer : public std::streambuf
+    {
+    protected:
+        /// @brief The ring being read from.
+        PipeRingPtr Ring;
+
+        /// @brief Releases the data that has been read back to the writer.
+        void ReleaseRead();
+    public:
+        /// @brief Class constructor.
+        /// @param Pipe The ring to read from.
+        PipeInputBuffer(PipeRingPtr Pipe);
+        /// @brief Class destructor.
+        virtual ~PipeInputBuffer();
+
+        /// @copydoc std::streambuf::underflow()
+        int_type underflow() override;
+        /// @copydoc std::streambuf::showmanyc()
+        std::streamsize showmanyc() override;
+        /// @copydoc std::streambuf::seekoff(off_type,std::ios_base::seekdir,std::ios_base::openmode)
+        /// @remarks Pipes can't seek, but the current position can be queried.
+        pos_type seekoff(off_type Offset, std::ios_base::seekdir Origin, std::ios_base::openmode Mode) override;
+    };//PipeInputBuffer
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief The streambuf for the write end of a pipe.
+    /// @details The put area is free space in the ring itself. Written data becomes visible to the reader when
+    /// the put area fills or the buffer is synced. The put area is limited to a fraction of the ring so data
+    /// keeps flowing to the reader during large writes.
+    ///////////////////////////////////////
+    class MEZZ_LIB PipeOutputBuffer : public std::streambuf
+    {
+    protected:
+        /// @brief The ring being written to.
+        PipeRingPtr Ring;
+        /// @brief The largest put area to use at once.
+        size_t MaxPutArea;
+
+        /// @brief Makes the data that has been written visible to the reader.
+        void PublishWrites();
+    public:
+        /// @brief Class constructor.
+        /// @param Pipe The ring to write to.
+        PipeOutputBuffer(PipeRingPtr Pipe);
+        /// @brief Class destructor.
+        virtual ~PipeOutputBuffer();
+
+        /// @copydoc std::streambuf::overflow(int_type)
+        int_type overflow(int_type Character) override;
+        /// @copydoc std::streambuf::sync()
+        int sync() override;
+        /// @copydoc std::streambuf::seekoff(off_type,std::ios_base::seekdir,std::ios_base::openmode)
+        /// @remarks Pipes can't seek, but the current position can be queried.
+        pos_type seekoff(off_type Offset, std::ios_base::seekdir Origin, std::ios_base::openmode Mode) override;
+    };//PipeOutputBuffer
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief The read end of a pipe between two threads.
+    ///////////////////////////////////////
+    class MEZZ_LIB PipeInputStream : public InputStream
+    {
+    protected:
+        /// @brief The ring shared with the other end of the pipe.
+        PipeRingPtr Ring;
+        /// @brief The buffer reading from the ring.
+        PipeInputBuffer PipeBuffer;
+    public:
+        /// @brief Class constructor.
+        /// @param Pipe The ring to read from.
+        PipeInputStream(PipeRingPtr Pipe);
+        /// @brief Class destructor.
+        virtual ~PipeInputStream() = default;
+
+        /// @copydoc StreamBase::GetIdentifier() const
+        [[nodiscard]] virtual String GetIdentifier() const;
+        /// @copydoc StreamBase::GetGroup() const
+        [[nodiscard]] virtual String GetGroup() const;
+        /// @copydoc StreamBase::GetSize() const
+        /// @remarks For a pipe this is the amount of data written but not yet read.
+        [[nodiscard]] virtual StreamSize GetSize() const;
+        /// @copydoc StreamBase::CanSeek() const
+        [[nodiscard]] virtual Boole CanSeek() const;
+        /// @copydoc StreamBase::IsEncrypted() const
+        [[nodiscard]] virtual Boole IsEncrypted() const;
+        /// @copydoc StreamBase::IsRaw() const
+        [[nodiscard]] virtual Boole IsRaw() const;
+    };//PipeInputStream
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief The write end of a pipe between two threads.
+    /// @remarks Destroying this Stream closes the pipe, after which the read end will reach EoF once it has
+    /// read everything that was written.
+    ///////////////////////////////////////
+    class MEZZ_LIB PipeOutputStream : public OutputStream
+    {
+    protected:
+        /// @brief The ring shared with the other end of the pipe.
+        PipeRingPtr Ring;
+        /// @brief The buffer writing to the ring.
+        PipeOutputBuffer PipeBuffer;
+    public:
+        /// @brief Class constructor.
+        /// @param Pipe The ring to write to.
+        PipeOutputStream(PipeRingPtr Pipe);
+        /// @brief Class destructor.
+        virtual ~PipeOutputStream() = default;
+
+        /// @copydoc StreamBase::GetIdentifier() const
+        [[nodiscard]] virtual String GetIdentifier() const;
+        /// @copydoc StreamBase::GetGroup() const
+        [[nodiscard]] virtual String GetGroup() const;
+        /// @copydoc StreamBase::GetSize() const
+        /// @remarks For a pipe this is the amount of data written but not yet read.
+        [[nodiscard]] virtual StreamSize GetSize() const;
+        /// @copydoc StreamBase::CanSeek() const
+        [[nodiscard]] virtual Boole CanSeek() const;
+        /// @copydoc StreamBase::IsEncrypted() const
+        [[nodiscard]] virtual Boole IsEncrypted() const;
+        /// @copydoc StreamBase::IsRaw() const
+        [[nodiscard]] virtual Boole IsRaw() const;
+    };//PipeOutputStream
+
+    RESTORE_WARNING_STATE
+
+    /// @brief Convenience type for the read end of a pipe in a shared_ptr.
+    using PipeInputStreamPtr = std::shared_ptr<PipeInputStream>;
+    /// @brief Convenience type for the write end of a pipe in a shared_ptr.
+    using PipeOutputStreamPtr = std::shared_ptr<PipeOutputStream>;
+
+    /// @brief Creates both ends of a pipe sharing a new ring.
+    /// @param Capacity The minimum number of bytes the pipe can hold. Rounded up to a power of two.
+    /// @param Policy What each end does when it has to wait on the other.
+    /// @return Returns a pair containing the read end and the write end of the pipe.
+    [[nodiscard]] MEZZ_LIB std::pair<PipeInputStreamPtr,PipeOutputStreamPtr> CreatePipe(
+        const size_t Capacity = PipeRing::DefaultCapacity,
+        const PipeWaitPolicy Policy = PipeWaitPolicy::Block);
+}//Mezzanine
+
+#endif
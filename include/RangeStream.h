@@ -0,0 +1,157 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_RangeStream_h
+#define Mezz_IOStreams_RangeStream_h
+
+/// @file
+/// @brief This file contains a Stream that reads a fixed range of another Stream.
+
+#ifndef SWIG
+    #include "BufferPool.h"
+    #include "InputStream.h"
+#endif
+
+namespace Mezzanine
+{
+    /// @brief A contiguous range of bytes within a Stream.
+    struct StreamRange
+    {
+        /// @brief The position in the Stream the range starts at.
+        StreamOff Start = 0;
+        /// @brief The number of bytes in the range.
+        StreamSize Size = 0;
+    };//StreamRange
+
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+    SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A streambuf that reads a range of another Stream with positional reads.
+    /// @details Positions are relative to the start of the range, and reading stops at the end of the range.
+    /// Since the source is only read through ReadAt, several of these can read different ranges of the same
+    /// Stream from different threads at once.
+    ///////////////////////////////////////
+    class MEZZ_LIB RangeInputBuffer : public std::streambuf
+    {
+    protected:
+        /// @brief The Stream the range is read from.
+        InputStreamBase* Source;
+        /// @brief The range of the source being read.
+        StreamRange Range;
+        /// @brief The position within the range of the start of the get area.
+        StreamOff BufferStart = 0;
+        /// @brief The storage for the get area.
+        BufferPool::BufferPtr Buffer;
+        /// @brief The number of bytes the get area storage can hold.
+        size_t BufferSize;
+
+        /// @brief Moves the read position, discarding the get area if the position is outside of it.
+        /// @param Position The new position relative to the start of the range.
+        /// @return Returns the new position, or -1 if it is outside the range.
+        pos_type MoveGetPointer(const StreamOff Position);
+    public:
+        /// @brief The default size of the get area.
+        static constexpr size_t DefaultBufferSize = 64 * 1024;
+
+        /// @brief Class constructor.
+        /// @param ToRead The Stream to read from. Must outlive this buffer.
+        /// @param ToReadRange The range of the Stream to read.
+        /// @param BufSize The size of the get area.
+        RangeInputBuffer(InputStreamBase& ToRead, const StreamRange ToReadRange, const size_t BufSize = DefaultBufferSize);
+        /// @brief Class destructor.
+        virtual ~RangeInputBuffer() = default;
+
+        /// @brief Gets the range being read.
+        /// @return Returns the range of the source Stream this buffer reads.
+        [[nodiscard]] StreamRange GetRange() const noexcept;
+
+        /// @copydoc std::streambuf::underflow()
+        int_type underflow() override;
+        /// @copydoc std::streambuf::showmanyc()
+        std::streamsize showmanyc() override;
+        /// @copydoc std::streambuf::seekoff(off_type,std::ios_base::seekdir,std::ios_base::openmode)
+        pos_type seekoff(off_type Offset, std::ios_base::seekdir Origin, std::ios_base::openmode Mode) override;
+        /// @copydoc std::streambuf::seekpos(pos_type,std::ios_base::openmode)
+        pos_type seekpos(pos_type Position, std::ios_base::openmode Mode) override;
+    };//RangeInputBuffer
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An input Stream over a range of another Stream.
+    ///////////////////////////////////////
+    class MEZZ_LIB RangeInputStream : public InputStream
+    {
+    protected:
+        /// @brief The Stream the range is read from.
+        InputStreamBase* Source;
+        /// @brief The buffer reading the range.
+        RangeInputBuffer RangeBuffer;
+    public:
+        /// @brief Class constructor.
+        /// @param ToRead The Stream to read from. Must outlive this Stream.
+        /// @param ToReadRange The range of the Stream to read.
+        RangeInputStream(InputStreamBase& ToRead, const StreamRange ToReadRange);
+        /// @brief Class destructor.
+        virtual ~RangeInputStream() = default;
+
+        /// @brief Gets the range being read.
+        /// @return Returns the range of the source Stream this Stream reads.
+        [[nodiscard]] StreamRange GetRange() const noexcept;
+
+        /// @copydoc StreamBase::GetIdentifier() const
+        /// @remarks This is the identifier of the source Stream.
+        [[nodiscard]] virtual String GetIdentifier() const;
+        /// @copydoc StreamBase::GetGroup() const
+        [[nodiscard]] virtual String GetGroup() const;
+        /// @copydoc StreamBase::GetSize() const
+        /// @remarks This is the size of the range.
+        [[nodiscard]] virtual StreamSize GetSize() const;
+        /// @copydoc StreamBase::CanSeek() const
+        [[nodiscard]] virtual Boole CanSeek() const;
+        /// @copydoc StreamBase::IsEncrypted() const
+        [[nodiscard]] virtual Boole IsEncrypted() const;
+        /// @copydoc StreamBase::IsRaw() const
+        [[nodiscard]] virtual Boole IsRaw() const;
+    };//RangeInputStream
+
+    RESTORE_WARNING_STATE
+}//Mezzanine
+
+#endif
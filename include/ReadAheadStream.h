@@ -0,0 +1,311 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_ReadAheadStream_h
+#define Mezz_IOStreams_ReadAheadStream_h
+
+/// @file
+/// @brief This file contains the streambuf and Stream classes for reading ahead of the read position on another thread.
+
+#ifndef SWIG
+    #include "BufferPool.h"
+    #include "InputStream.h"
+
+    #include <condition_variable>
+    #include <deque>
+    #include <thread>
+#endif
+
+namespace Mezzanine
+{
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+    SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A read-only streambuf that fills buffers ahead of the read position on a background thread.
+    /// @details While the data in one buffer is being consumed, a worker thread reads the following windows of
+    /// the source streambuf into the remaining buffers. An underflow then usually only has to swap to a buffer
+    /// that is already full rather than wait on the source.
+    /// @n @n
+    /// Seeks within or ahead into the buffered data are cheap. Seeks elsewhere discard the buffered data, and
+    /// when several of these happen without much sequential reading between them the buffer assumes the
+    /// access pattern is random and stops prefetching. Prefetching resumes once reads become sequential again.
+    /// @n @n
+    /// The source streambuf must not be used by anything else while it is attached to this buffer.
+    ///////////////////////////////////////
+    class MEZZ_LIB ReadAheadBuffer : public std::streambuf
+    {
+    public:
+        /// @brief The number of bytes read from the source at a time if no other size is specified.
+        static constexpr StreamSize DefaultWindowSize = 64 * 1024;
+        /// @brief The number of buffers to use if no other count is specified.
+        static constexpr size_t DefaultBufferCount = 3;
+        /// @brief The number of seeks outside of the buffered data that will disable prefetching.
+        static constexpr size_t RandomSeekThreshold = 2;
+        /// @brief The number of sequential buffer swaps that will re-enable prefetching.
+        static constexpr size_t SequentialReadThreshold = 4;
+    protected:
+        /// @brief A single window of data read from the source.
+        struct ReadBlock
+        {
+            /// @brief The data read from the source.
+            BufferPool::BufferPtr Data;
+            /// @brief The position in the source the data was read from.
+            StreamOff Start = 0;
+            /// @brief The number of valid bytes in the Data.
+            StreamSize Size = 0;
+        };//ReadBlock
+
+        /// @brief Storage for every block used by this buffer.
+        std::vector<ReadBlock> Blocks;
+        /// @brief Blocks that have been filled and are waiting to be read, in Stream order.
+        std::deque<ReadBlock*> ReadyBlocks;
+        /// @brief Blocks that are available to be filled.
+        std::vector<ReadBlock*> FreeBlocks;
+        /// @brief The thread filling blocks in the background.
+        std::thread Prefetcher;
+        /// @brief Mutex protecting the block lists and state shared with the prefetch thread.
+        std::mutex BlockLock;
+        /// @brief Condition used to signal changes to the block lists and state.
+        std::condition_variable BlockCondition;
+        /// @brief The streambuf data is being read from.
+        std::streambuf* Source = nullptr;
+        /// @brief The block currently exposed as the get area.
+        ReadBlock* Current = nullptr;
+        /// @brief The position in the source the get area starts at.
+        StreamOff CurrentStart = 0;
+        /// @brief The position in the source the next block will be filled from.
+        StreamOff NextFillStart = 0;
+        /// @brief Incremented whenever buffered data is discarded so in-flight fills can be thrown out.
+        UInt64 Generation = 0;
+        /// @brief The number of seeks outside of the buffered data since the last run of sequential reads.
+        size_t RandomSeeks = 0;
+        /// @brief The number of buffer swaps since the last seek outside of the buffered data.
+        size_t SequentialReads = 0;
+        /// @brief The number of bytes read from the source at a time.
+        StreamSize WindowSize;
+        /// @brief Whether or not the prefetch thread is reading from the source right now.
+        Boole Filling = false;
+        /// @brief Whether or not a read from the source has come up short.
+        Boole SourceEnded = false;
+        /// @brief Whether or not the prefetch thread is permitted to fill blocks.
+        Boole PrefetchEnabled = true;
+        /// @brief Whether or not the prefetch thread should exit.
+        Boole ShuttingDown = false;
+
+        /// @brief The function run by the prefetch thread.
+        void PrefetchData();
+        /// @brief Starts the prefetch thread.
+        void StartPrefetcher();
+        /// @brief Stops the prefetch thread and waits for it to exit.
+        void StopPrefetcher();
+        /// @brief Returns the current and all ready blocks to the free list.
+        /// @remarks The block lock must be held and no fill may be in flight when this is called.
+        void DiscardBlocks();
+        /// @brief Makes a block the current block and exposes it as the get area.
+        /// @param Block The block to use.
+        /// @param Offset The number of bytes into the block to place the read position.
+        void UseBlock(ReadBlock* Block, const StreamOff Offset);
+        /// @brief Moves the read position to a position in the source.
+        /// @param Position The absolute position to move to.
+        /// @param Origin The origin that should be used to seek the source if the position isn't buffered.
+        /// @param Offset The offset to use to seek the source if the position isn't buffered.
+        /// @return Returns the new position, or an invalid position if the seek failed.
+        pos_type MoveTo(const StreamOff Position, std::ios_base::seekdir Origin, const StreamOff Offset);
+    public:
+        /// @brief Blank constructor.
+        /// @param Window The number of bytes to read from the source at a time.
+        /// @param BufferCount The number of windows to keep in memory. At least two will be used.
+        ReadAheadBuffer(const StreamSize Window = DefaultWindowSize, const size_t BufferCount = DefaultBufferCount);
+        /// @brief Source constructor.
+        /// @param Src The streambuf to read from.
+        /// @param Window The number of bytes to read from the source at a time.
+        /// @param BufferCount The number of windows to keep in memory. At least two will be used.
+        ReadAheadBuffer(std::streambuf* Src,
+                        const StreamSize Window = DefaultWindowSize,
+                        const size_t BufferCount = DefaultBufferCount);
+        /// @brief Copy constructor.
+        /// @param Other The other buffer to not be copied.
+        ReadAheadBuffer(const ReadAheadBuffer& Other) = delete;
+        /// @brief Move constructor.
+        /// @param Other The other buffer to not be moved.
+        ReadAheadBuffer(ReadAheadBuffer&& Other) = delete;
+        /// @brief Class destructor.
+        virtual ~ReadAheadBuffer();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Operators
+
+        /// @brief Copy assignment operator.
+        /// @param Other The other buffer to not be copied.
+        /// @return Returns a reference to this.
+        ReadAheadBuffer& operator=(const ReadAheadBuffer& Other) = delete;
+        /// @brief Move assignment operator.
+        /// @param Other The other buffer to not be moved.
+        /// @return Returns a reference to this.
+        ReadAheadBuffer& operator=(ReadAheadBuffer&& Other) = delete;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Configuration
+
+        /// @brief Sets the streambuf to read from.
+        /// @remarks Any buffered data is discarded. Reading will begin at the current position of the new source.
+        /// @param Src The streambuf to read from, or nullptr to detach the current source.
+        void SetSource(std::streambuf* Src);
+        /// @brief Gets the streambuf being read from.
+        /// @return Returns a pointer to the source streambuf, or nullptr if there is none.
+        [[nodiscard]] std::streambuf* GetSource() const noexcept;
+        /// @brief Gets the number of bytes read from the source at a time.
+        /// @return Returns the size of each buffer used for read ahead.
+        [[nodiscard]] StreamSize GetWindowSize() const noexcept;
+        /// @brief Gets the number of windows kept in memory.
+        /// @return Returns the number of buffers used for read ahead, including the one being read from.
+        [[nodiscard]] size_t GetBufferCount() const noexcept;
+        /// @brief Gets whether or not data is currently being read ahead.
+        /// @return Returns false if a random access pattern has been detected, true otherwise.
+        [[nodiscard]] Boole IsPrefetching();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Positional Reads
+
+        /// @brief Reads from a position in the source without moving the read position or disturbing read ahead.
+        /// @remarks Data that is already buffered is copied from the buffers. Anything else is read from the
+        /// source while the prefetch thread is held off, and the source is put back where prefetching left it.
+        /// This doesn't count as a seek when detecting random access. It is safe to call from other threads
+        /// while this buffer is being read from.
+        /// @param Position The position in the source to start reading from.
+        /// @param Buffer The buffer to be populated with the read data.
+        /// @param Size The number of bytes to read.
+        /// @return Returns the number of bytes read, or -1 if the source couldn't be put back afterwards.
+        StreamSize ReadAt(const StreamOff Position, Char8* Buffer, const StreamSize Size);
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Internal Buffer Operations
+
+        /// @copydoc std::streambuf::underflow()
+        int_type underflow() override;
+        /// @copydoc std::streambuf::seekoff(off_type,std::ios_base::seekdir,std::ios_base::openmode)
+        pos_type seekoff(off_type Offset, std::ios_base::seekdir Origin, std::ios_base::openmode Mode) override;
+        /// @copydoc std::streambuf::seekpos(pos_type,std::ios_base::openmode)
+        pos_type seekpos(pos_type Position, std::ios_base::openmode Mode) override;
+    };//ReadAheadBuffer
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An input Stream that reads a file ahead of the read position on a background thread.
+    ///////////////////////////////////////
+    class MEZZ_LIB ReadAheadInputStream : public InputStream
+    {
+    protected:
+        /// @brief The buffer reading the file.
+        std::filebuf FileBuffer;
+        /// @brief The buffer reading ahead of the read position.
+        ReadAheadBuffer ReadBuffer;
+        /// @brief The name of the open file.
+        String FileName;
+        /// @brief The size of the open file.
+        StreamSize FileSize = 0;
+    public:
+        /// @brief Blank constructor.
+        /// @param Window The number of bytes to read from the file at a time.
+        /// @param BufferCount The number of windows to keep in memory. At least two will be used.
+        ReadAheadInputStream(const StreamSize Window = ReadAheadBuffer::DefaultWindowSize,
+                             const size_t BufferCount = ReadAheadBuffer::DefaultBufferCount);
+        /// @brief File constructor.
+        /// @remarks If the file fails to open the Stream will have it's fail bit set.
+        /// @param File The name of the file to open.
+        /// @param Window The number of bytes to read from the file at a time.
+        /// @param BufferCount The number of windows to keep in memory. At least two will be used.
+        ReadAheadInputStream(const String& File,
+                             const StreamSize Window = ReadAheadBuffer::DefaultWindowSize,
+                             const size_t BufferCount = ReadAheadBuffer::DefaultBufferCount);
+        /// @brief Class destructor.
+        virtual ~ReadAheadInputStream() = default;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // File Operations
+
+        /// @brief Opens a file for reading.
+        /// @remarks If a file is already open it will be closed first. On failure the fail bit will be set.
+        /// @param File The name of the file to open.
+        void OpenFile(const String& File);
+        /// @brief Closes the current file.
+        void CloseFile();
+        /// @brief Gets whether or not a file is open.
+        /// @return Returns true if a file is currently open, false otherwise.
+        [[nodiscard]] Boole IsOpen() const;
+
+        /// @brief Gets whether or not data is currently being read ahead.
+        /// @return Returns false if a random access pattern has been detected, true otherwise.
+        [[nodiscard]] Boole IsPrefetching();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Input Functions
+
+        /// @copydoc InputStreamBase::ReadAt(const StreamPos, void*, const StreamSize)
+        /// @remarks This reads through the read ahead buffers rather than seeking the Stream, so it leaves read
+        /// ahead running for sequential reads and can be used alongside them without any locking. If the file
+        /// position can't be put back afterwards read ahead stops, and sequential reads end where it stopped.
+        virtual StreamSize ReadAt(const StreamPos Position, void* Buffer, const StreamSize Size);
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Stream Base Operations
+
+        /// @copydoc StreamBase::GetIdentifier() const
+        [[nodiscard]] virtual String GetIdentifier() const;
+        /// @copydoc StreamBase::GetGroup() const
+        [[nodiscard]] virtual String GetGroup() const;
+
+        /// @copydoc StreamBase::GetSize() const
+        [[nodiscard]] virtual StreamSize GetSize() const;
+        /// @copydoc StreamBase::CanSeek() const
+        [[nodiscard]] virtual Boole CanSeek() const;
+        /// @copydoc StreamBase::IsEncrypted() const
+        [[nodiscard]] virtual Boole IsEncrypted() const;
+        /// @copydoc StreamBase::IsRaw() const
+        [[nodiscard]] virtual Boole IsRaw() const;
+    };//ReadAheadInputStream
+
+    RESTORE_WARNING_STATE
+
+    /// @brief Convenience type for a read ahead input stream in a shared_ptr.
+    using ReadAheadInputStreamPtr = std::shared_ptr<ReadAheadInputStream>;
+}//Mezzanine
+
+#endif
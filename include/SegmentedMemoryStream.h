@@ -0,0 +1,183 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_SegmentedMemoryStream_h
+#define Mezz_IOStreams_SegmentedMemoryStream_h
+
+/// @file
+/// @brief This file contains a memory Stream made of fixed size segments that never reallocates.
+
+#ifndef SWIG
+    #include "BufferPool.h"
+    #include "InputOutputStream.h"
+#endif
+
+namespace Mezzanine
+{
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+    SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A growable memory streambuf made of fixed size segments.
+    /// @details Growing the buffer adds a segment rather than reallocating, so written data is never moved
+    /// or copied. The get and put areas are always within a single segment. Segments are drawn from and
+    /// returned to the BufferPool.
+    ///////////////////////////////////////
+    class MEZZ_LIB SegmentedMemoryBuffer : public std::streambuf
+    {
+    public:
+        /// @brief The size of each segment if no other size is specified.
+        static constexpr size_t DefaultSegmentSize = 64 * 1024;
+    protected:
+        /// @brief The segments holding the data, in order.
+        std::vector<BufferPool::BufferPtr> Segments;
+        /// @brief The size of each segment in bytes.
+        size_t SegmentSize;
+        /// @brief The number of bytes written, not counting the current put area.
+        StreamSize DataSize = 0;
+        /// @brief The position of the start of the get area.
+        StreamSize ReadBase = 0;
+        /// @brief The index of the segment holding the put area.
+        size_t WriteSegment = 0;
+
+        /// @brief Accounts for any data written to the put area in DataSize.
+        void UpdateDataSize();
+        /// @brief Gets the current read position.
+        /// @return Returns the position of the next byte to be read.
+        [[nodiscard]] StreamSize GetReadPos() const;
+        /// @brief Gets the current write position.
+        /// @return Returns the position of the next byte to be written.
+        [[nodiscard]] StreamSize GetWritePos() const;
+        /// @brief Moves the get area to a position.
+        /// @param Position The position to move to. Must not be beyond the written data.
+        void MoveReadTo(const StreamSize Position);
+        /// @brief Moves the put area to a position, adding a segment if needed.
+        /// @param Position The position to move to. Must not be beyond the written data.
+        void MoveWriteTo(const StreamSize Position);
+    public:
+        /// @brief Class constructor.
+        /// @param SegSize The size of each segment in bytes.
+        SegmentedMemoryBuffer(const size_t SegSize = DefaultSegmentSize);
+        /// @brief Class destructor.
+        virtual ~SegmentedMemoryBuffer();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Segment Access
+
+        /// @brief Gets the number of bytes written to this buffer.
+        /// @return Returns the size of the data in this buffer.
+        [[nodiscard]] StreamSize GetDataSize() const;
+        /// @brief Gets the size of each segment.
+        /// @return Returns the size in bytes of every segment in this buffer.
+        [[nodiscard]] size_t GetSegmentSize() const noexcept;
+        /// @brief Gets the data in this buffer as a list of segments.
+        /// @remarks The segments are only valid until the buffer is next written to or cleared.
+        /// @return Returns a vector of segments that together hold all of the data in order.
+        [[nodiscard]] std::vector<StreamWriteSegment> GetSegments();
+        /// @brief Removes all data, returning every segment to the BufferPool.
+        void Clear();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Streambuf Overrides
+
+        /// @copydoc std::streambuf::underflow()
+        int_type underflow() override;
+        /// @copydoc std::streambuf::overflow(int_type)
+        int_type overflow(int_type Character) override;
+        /// @copydoc std::streambuf::showmanyc()
+        std::streamsize showmanyc() override;
+        /// @copydoc std::streambuf::seekoff(off_type,std::ios_base::seekdir,std::ios_base::openmode)
+        pos_type seekoff(off_type Offset, std::ios_base::seekdir Origin, std::ios_base::openmode Mode) override;
+        /// @copydoc std::streambuf::seekpos(pos_type,std::ios_base::openmode)
+        pos_type seekpos(pos_type Position, std::ios_base::openmode Mode) override;
+    };//SegmentedMemoryBuffer
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A growable memory Stream that never reallocates or coalesces its data.
+    /// @details Data written can be read back through the same Stream, or handed as-is to a vectored write.
+    ///////////////////////////////////////
+    class MEZZ_LIB SegmentedMemoryStream : public InputOutputStream
+    {
+    protected:
+        /// @brief The buffer holding the data.
+        SegmentedMemoryBuffer SegmentBuffer;
+    public:
+        /// @brief Class constructor.
+        /// @param SegSize The size of each segment in bytes.
+        SegmentedMemoryStream(const size_t SegSize = SegmentedMemoryBuffer::DefaultSegmentSize);
+        /// @brief Class destructor.
+        virtual ~SegmentedMemoryStream() = default;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Segment Access
+
+        /// @copydoc SegmentedMemoryBuffer::GetSegments()
+        [[nodiscard]] std::vector<StreamWriteSegment> GetSegments();
+        /// @brief Writes all of the data in this Stream to another Stream with a single vectored write.
+        /// @param Dest The Stream to write to.
+        /// @return Returns true if all the data was written, false otherwise.
+        Boole WriteTo(OutputStreamBase& Dest);
+        /// @copydoc SegmentedMemoryBuffer::Clear()
+        void Clear();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Stream Base Operations
+
+        /// @copydoc StreamBase::GetIdentifier() const
+        [[nodiscard]] virtual String GetIdentifier() const;
+        /// @copydoc StreamBase::GetGroup() const
+        [[nodiscard]] virtual String GetGroup() const;
+        /// @copydoc StreamBase::GetSize() const
+        [[nodiscard]] virtual StreamSize GetSize() const;
+        /// @copydoc StreamBase::CanSeek() const
+        [[nodiscard]] virtual Boole CanSeek() const;
+        /// @copydoc StreamBase::IsEncrypted() const
+        [[nodiscard]] virtual Boole IsEncrypted() const;
+        /// @copydoc StreamBase::IsRaw() const
+        [[nodiscard]] virtual Boole IsRaw() const;
+    };//SegmentedMemoryStream
+
+    RESTORE_WARNING_STATE
+
+    /// @brief Convenience type for a SegmentedMemoryStream in a shared_ptr.
+    using SegmentedMemoryStreamPtr = std::shared_ptr<SegmentedMemoryStream>;
+}//Mezzanine
+
+#endif
@@ -45,6 +45,8 @@
 
 #ifndef SWIG
     #include "DataTypes.h"
+
+    #include <future>
 #endif
 
 namespace Mezzanine
@@ -81,6 +83,24 @@ namespace Mezzanine
         End       = std::ios_base::end   ///< The end of the Stream.
     };
 
+    /// @brief A region of memory to be filled by a vectored read.
+    struct StreamReadSegment
+    {
+        /// @brief The start of the memory to be filled.
+        void* Buffer = nullptr;
+        /// @brief The number of bytes to read into the Buffer.
+        StreamSize Size = 0;
+    };//StreamReadSegment
+
+    /// @brief A region of memory to be written by a vectored write.
+    struct StreamWriteSegment
+    {
+        /// @brief The start of the memory to be written.
+        const void* Buffer = nullptr;
+        /// @brief The number of bytes to write from the Buffer.
+        StreamSize Size = 0;
+    };//StreamWriteSegment
+
     SAVE_WARNING_STATE
     SUPPRESS_CLANG_WARNING("-Wweak-vtables")
 
@@ -162,6 +182,14 @@ namespace Mezzanine
         /// @param Size The number of bytes to read from the Stream.
         /// @return Returns the number of bytes successfully read.
         virtual size_t Read(void* Buffer, const StreamSize Size) = 0;
+        /// @brief Reads from the Stream into several buffers in order.
+        /// @remarks This is the same as calling Read for each segment, and each segment checks the Stream state
+        /// and updates gcount the same way Read does. Reading stops at the first segment that couldn't be
+        /// completely filled.
+        /// @param Segments An array of the buffers to be populated with the read data.
+        /// @param Count The number of segments in the array.
+        /// @return Returns the total number of bytes successfully read.
+        virtual StreamSize ReadV(const StreamReadSegment* Segments, const size_t Count) = 0;
         /// @brief Reads a single line from a String.
         /// @param Buffer Pointer to the buffer to copy to.
         /// @param Size The size of the Buffer parameter.
@@ -169,6 +197,49 @@ namespace Mezzanine
         /// @return Returns the number of bytes actually read, not including the Delimiter.
         virtual size_t ReadLine(Char8* Buffer, const StreamSize Size, const Char8 Delim = '\n') = 0;
 
+        /// @brief Gets a view of data in the Stream without advancing the read position.
+        /// @remarks Data already buffered by the Stream is returned in place without being copied. Data that
+        /// spans the end of the internal buffer of the Stream is copied to a scratch buffer owned by the Stream.
+        /// The view is only valid until the next operation on the Stream.
+        /// @param Size The number of bytes to look at.
+        /// @return Returns a view of up to Size bytes starting at the current read position.
+        [[nodiscard]] virtual StringView Peek(const StreamSize Size) = 0;
+        /// @brief Gets a view of data in the Stream and advances the read position past it.
+        /// @remarks Data already buffered by the Stream is returned in place without being copied. Data that
+        /// spans the end of the internal buffer of the Stream is copied to a scratch buffer owned by the Stream.
+        /// The view is only valid until the next operation on the Stream.
+        /// @param Size The number of bytes to read.
+        /// @return Returns a view of up to Size bytes that started at the read position.
+        [[nodiscard]] virtual StringView Acquire(const StreamSize Size) = 0;
+        /// @brief Advances the read position without copying any data.
+        /// @remarks This is intended to be paired with Peek, to skip data once it has been inspected.
+        /// @param Size The number of bytes to advance.
+        /// @return Returns the number of bytes actually advanced.
+        virtual StreamSize Consume(const StreamSize Size) = 0;
+        /// @brief Reads from a position in the Stream without using or changing the read position.
+        /// @remarks This is safe to call from multiple threads at once on the same Stream. Streams that can
+        /// address their data directly, such as memory mapped and read ahead Streams, service these calls
+        /// concurrently and alongside other use of the Stream. Others fall back to moving the shared cursor and
+        /// putting it back, which is serialized with other calls to this but not with anything else, so those
+        /// Streams must not otherwise be used while a call is in progress on another thread.
+        /// @param Position The position in the Stream to start reading from.
+        /// @param Buffer The buffer to be populated with the read data.
+        /// @param Size The number of bytes to read from the Stream.
+        /// @return Returns the number of bytes successfully read.
+        virtual StreamSize ReadAt(const StreamPos Position, void* Buffer, const StreamSize Size) = 0;
+        /// @brief Reads from a position in the Stream on another thread.
+        /// @remarks The read is performed with ReadAt by the default AsyncReadQueue, so once it is done the read
+        /// position of the Stream is where it was. Whether the Stream can be used while the read is in flight,
+        /// and how many reads can be in flight at once, is the same as for ReadAt. Both the Stream and the Buffer
+        /// must remain valid until the returned future is ready.
+        /// @param Position The position in the Stream to start reading from.
+        /// @param Buffer The buffer to be populated with the read data.
+        /// @param Size The number of bytes to read from the Stream.
+        /// @return Returns a future that will contain the number of bytes successfully read.
+        [[nodiscard]] virtual std::future<StreamSize> ReadAsync(const StreamPos Position,
+                                                                void* Buffer,
+                                                                const StreamSize Size) = 0;
+
         /// @brief Sets the position of the read cursor explicitly.
         /// @param Position The position to be set.Stream
         virtual void SetReadPosition(StreamPos Position) = 0;
@@ -201,6 +272,13 @@ namespace Mezzanine
         /// @param Size The size of the buffer being passed in.
         /// @return Returns true if the Stream remained valid through the operation and can be written to again.
         virtual Boole Write(const void* Buffer, StreamSize Size) = 0;
+        /// @brief Writes several buffers to the Stream in order.
+        /// @remarks This behaves as though Write were called for each segment, but only checks the Stream state
+        /// once. Writing stops at the first segment that couldn't be completely written.
+        /// @param Segments An array of the buffers to write to this Stream.
+        /// @param Count The number of segments in the array.
+        /// @return Returns true if the Stream remained valid through the operation and can be written to again.
+        virtual Boole WriteV(const StreamWriteSegment* Segments, const size_t Count) = 0;
 
         /// @brief Sets the position of the write cursor explicitly.
         /// @param Position The position to be set.
@@ -0,0 +1,245 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_StreamTools_h
+#define Mezz_IOStreams_StreamTools_h
+
+/// @file
+/// @brief This file contains utilities for working directly with the buffers underneath standard Streams.
+
+#ifndef SWIG
+    #include "StreamBase.h"
+
+    #include <cstring>
+    #include <limits>
+#endif
+
+namespace Mezzanine
+{
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A helper that grants access to the protected buffer pointers of any streambuf.
+    /// @details The standard library only exposes the get and put areas of a streambuf to derived types. This
+    /// type is never instantiated, it only exists to form member pointers to those protected functions so that
+    /// code operating on a Stream can look at and move through the data already buffered without going through
+    /// the virtual interface of the streambuf.
+    ///////////////////////////////////////
+    class StreamBufferAccess : public std::streambuf
+    {
+    public:
+        /// @brief Deleted constructor.
+        StreamBufferAccess() = delete;
+
+        /// @brief Gets the start of the get area of a streambuf.
+        /// @param Buf The streambuf to access.
+        /// @return Returns a pointer to the first character of the get area.
+        [[nodiscard]] static Char8* GetBegin(std::streambuf* Buf) noexcept
+            { return (Buf->*(&StreamBufferAccess::eback))(); }
+        /// @brief Gets the current read position in the get area of a streambuf.
+        /// @param Buf The streambuf to access.
+        /// @return Returns a pointer to the next character that will be read.
+        [[nodiscard]] static Char8* GetCurrent(std::streambuf* Buf) noexcept
+            { return (Buf->*(&StreamBufferAccess::gptr))(); }
+        /// @brief Gets the end of the get area of a streambuf.
+        /// @param Buf The streambuf to access.
+        /// @return Returns a pointer to one past the last character in the get area.
+        [[nodiscard]] static Char8* GetEnd(std::streambuf* Buf) noexcept
+            { return (Buf->*(&StreamBufferAccess::egptr))(); }
+        /// @brief Moves the read position in the get area of a streambuf.
+        /// @remarks No bounds checking is performed. The caller must ensure the new position is in the get area.
+        /// @param Buf The streambuf to access.
+        /// @param Count The number of characters to advance.
+        static void GetAdvance(std::streambuf* Buf, const StreamSize Count) noexcept
+        {
+            Char8* Begin = GetBegin(Buf);
+            (Buf->*(&StreamBufferAccess::setg))(Begin,GetCurrent(Buf) + Count,GetEnd(Buf));
+        }
+
+        /// @brief Gets the current write position in the put area of a streambuf.
+        /// @param Buf The streambuf to access.
+        /// @return Returns a pointer to where the next character will be written.
+        [[nodiscard]] static Char8* PutCurrent(std::streambuf* Buf) noexcept
+            { return (Buf->*(&StreamBufferAccess::pptr))(); }
+        /// @brief Gets the end of the put area of a streambuf.
+        /// @param Buf The streambuf to access.
+        /// @return Returns a pointer to one past the last character in the put area.
+        [[nodiscard]] static Char8* PutEnd(std::streambuf* Buf) noexcept
+            { return (Buf->*(&StreamBufferAccess::epptr))(); }
+        /// @brief Moves the write position in the put area of a streambuf.
+        /// @remarks No bounds checking is performed. The caller must ensure the new position is in the put area.
+        /// @param Buf The streambuf to access.
+        /// @param Count The number of characters to advance.
+        static void PutAdvance(std::streambuf* Buf, const StreamSize Count) noexcept
+        {
+            constexpr StreamSize MaxStep = std::numeric_limits<int>::max();
+            StreamSize Remaining = Count;
+            for( ; Remaining > MaxStep ; Remaining -= MaxStep )
+                { (Buf->*(&StreamBufferAccess::pbump))( static_cast<int>(MaxStep) ); }
+            (Buf->*(&StreamBufferAccess::pbump))( static_cast<int>(Remaining) );
+        }
+    };//StreamBufferAccess
+
+    RESTORE_WARNING_STATE
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A collection of functions for operating on the buffers underneath standard Streams.
+    ///////////////////////////////////////
+    namespace StreamTools
+    {
+        /// @brief Gets the number of characters that can be read without the streambuf fetching more data.
+        /// @param Buf The streambuf to check.
+        /// @return Returns the number of characters currently available in the get area.
+        [[nodiscard]] inline StreamSize GetAvailable(std::streambuf* Buf) noexcept
+            { return StreamBufferAccess::GetEnd(Buf) - StreamBufferAccess::GetCurrent(Buf); }
+        /// @brief Gets the number of characters that can be written without the streambuf flushing.
+        /// @param Buf The streambuf to check.
+        /// @return Returns the number of characters of space currently available in the put area.
+        [[nodiscard]] inline StreamSize GetWritable(std::streambuf* Buf) noexcept
+            { return StreamBufferAccess::PutEnd(Buf) - StreamBufferAccess::PutCurrent(Buf); }
+
+        /// @brief Reads straight out of the get area of a Stream, skipping the sentry and virtual calls.
+        /// @remarks This only succeeds when the result would be no different from a call to read, that is when
+        /// the Stream is good, not tied to another Stream, and already holds all of the requested data. It
+        /// does not update gcount.
+        /// @param Stream The Stream to read from.
+        /// @param Buffer The buffer to be populated with the read data.
+        /// @param Size The number of bytes to read.
+        /// @return Returns true if the data was read, false if nothing was done and a normal read is needed.
+        [[nodiscard]] inline Boole TryReadBuffered(std::istream& Stream, void* Buffer, const StreamSize Size) noexcept
+        {
+            std::streambuf* Buf = Stream.rdbuf();
+            if( !Stream.good() || Stream.tie() != nullptr || GetAvailable(Buf) < Size ) {
+                return false;
+            }
+            std::memcpy(Buffer,StreamBufferAccess::GetCurrent(Buf),static_cast<size_t>(Size));
+            StreamBufferAccess::GetAdvance(Buf,Size);
+            return true;
+        }
+        /// @brief Writes straight into the put area of a Stream, skipping the sentry and virtual calls.
+        /// @remarks This only succeeds when the result would be no different from a call to write, that is when
+        /// the Stream is good, not tied to another Stream, not unit buffered, and has room for all of the data.
+        /// @param Stream The Stream to write to.
+        /// @param Buffer The data to write.
+        /// @param Size The number of bytes to write.
+        /// @return Returns true if the data was written, false if nothing was done and a normal write is needed.
+        [[nodiscard]] inline Boole TryWriteBuffered(std::ostream& Stream, const void* Buffer, const StreamSize Size) noexcept
+        {
+            std::streambuf* Buf = Stream.rdbuf();
+            if( !Stream.good() || Stream.tie() != nullptr || ( Stream.flags() & std::ios_base::unitbuf ) ||
+                GetWritable(Buf) < Size )
+            {
+                return false;
+            }
+            std::memcpy(StreamBufferAccess::PutCurrent(Buf),Buffer,static_cast<size_t>(Size));
+            StreamBufferAccess::PutAdvance(Buf,Size);
+            return true;
+        }
+
+        /// @brief Finds the first occurrence of a character in a range.
+        /// @remarks Compares 16 or 32 characters at a time with SSE2, AVX2 or NEON when the build targets them,
+        /// and one at a time otherwise.
+        /// @param Begin The start of the range to search.
+        /// @param End One past the end of the range to search.
+        /// @param Target The character to find.
+        /// @return Returns a pointer to the first occurrence of Target, or End if it wasn't found.
+        [[nodiscard]] MEZZ_LIB const Char8* FindCharacter(const Char8* Begin, const Char8* End, const Char8 Target) noexcept;
+
+        /// @brief Gets a view of data in a Stream without advancing the read position.
+        /// @remarks If the requested data is in the buffer of the Stream it is returned in place. Otherwise it
+        /// will be copied to the Scratch buffer and the read position restored with a seek. If the Stream can't
+        /// seek, only the data currently in the buffer is returned and the view may be shorter than requested.
+        /// @n @n
+        /// The returned view is only valid until the next operation on the Stream or Scratch buffer.
+        /// @param Stream The Stream to look at.
+        /// @param Size The number of bytes to look at.
+        /// @param Scratch A buffer that can be used to hold the data if it isn't contiguous in the Stream.
+        /// @return Returns a view of up to Size bytes of data starting at the read position.
+        [[nodiscard]] MEZZ_LIB StringView Peek(std::istream& Stream, const StreamSize Size, std::vector<Char8>& Scratch);
+        /// @brief Gets a view of data in a Stream and advances the read position past it.
+        /// @remarks If the requested data is in the buffer of the Stream it is returned in place. Otherwise it
+        /// will be copied to the Scratch buffer. If fewer bytes than requested remain, the fail and EoF bits will
+        /// be set on the Stream.
+        /// @n @n
+        /// The returned view is only valid until the next operation on the Stream or Scratch buffer.
+        /// @param Stream The Stream to read from.
+        /// @param Size The number of bytes to read.
+        /// @param Scratch A buffer that can be used to hold the data if it isn't contiguous in the Stream.
+        /// @return Returns a view of up to Size bytes of data that were at the read position.
+        [[nodiscard]] MEZZ_LIB StringView Acquire(std::istream& Stream, const StreamSize Size, std::vector<Char8>& Scratch);
+        /// @brief Advances the read position of a Stream.
+        /// @param Stream The Stream to advance.
+        /// @param Size The number of bytes to advance.
+        /// @return Returns the number of bytes actually skipped.
+        MEZZ_LIB StreamSize Consume(std::istream& Stream, const StreamSize Size);
+        /// @brief Reads from a specific position in a Stream and then restores the read position.
+        /// @remarks This operates directly on the streambuf of the Stream and won't alter the error state of the
+        /// Stream, unless the read position can't be restored afterwards. Then the bad bit is set, since the
+        /// read position is no longer where the caller left it. It does move the shared cursor while it works,
+        /// so it must not run concurrently with any other operation on the same Stream.
+        /// @param Stream The Stream to read from.
+        /// @param Position The position in the Stream to start reading from.
+        /// @param Buffer The buffer to be populated with the read data.
+        /// @param Size The number of bytes to read.
+        /// @return Returns the number of bytes successfully read, or 0 if the read position couldn't be restored.
+        MEZZ_LIB StreamSize ReadAt(std::istream& Stream, const StreamPos Position, void* Buffer, const StreamSize Size);
+        /// @brief Reads from a Stream into several buffers in order.
+        /// @remarks Each segment is read with a call to read, so the Stream state, gcount, and any exceptions are
+        /// handled the same way. gcount reports the bytes read into the last segment that was attempted. If a
+        /// segment can't be completely filled reading stops and the fail and EoF bits are set on the Stream.
+        /// @param Stream The Stream to read from.
+        /// @param Segments An array of the buffers to be populated with the read data.
+        /// @param Count The number of segments in the array.
+        /// @return Returns the total number of bytes successfully read.
+        MEZZ_LIB StreamSize ReadV(std::istream& Stream, const StreamReadSegment* Segments, const size_t Count);
+        /// @brief Writes several buffers to a Stream in order.
+        /// @remarks The Stream state is checked once for the whole operation rather than once per segment. If a
+        /// segment can't be completely written, or the streambuf throws, writing stops and the bad bit is set on
+        /// the Stream. Exceptions from the streambuf are only rethrown if the Stream has exceptions enabled for
+        /// the bad bit.
+        /// @param Stream The Stream to write to.
+        /// @param Segments An array of the buffers to write to the Stream.
+        /// @param Count The number of segments in the array.
+        /// @return Returns the total number of bytes successfully written.
+        MEZZ_LIB StreamSize WriteV(std::ostream& Stream, const StreamWriteSegment* Segments, const size_t Count);
+    }//StreamTools
+}//Mezzanine
+
+#endif
@@ -42,10 +42,17 @@
 
 #ifndef SWIG
     #include "InputStream.h"
+
+    #include <charconv>
+    #include <cstdlib>
+    #include <iterator>
+    #include <type_traits>
 #endif
 
 namespace Mezzanine
 {
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief An input Stream (in text mode) helper class for safer streaming.
     ///////////////////////////////////////
@@ -54,7 +61,147 @@ namespace Mezzanine
     protected:
         /// @brief A pointer to the Stream being read from.
         StdInputStreamPtr Stream;
+        /// @brief The reusable buffer for lines that cross the end of the Stream buffer.
+        String LineScratch;
+        /// @brief The reusable buffer for numbers that cross the end of the Stream buffer.
+        String NumberScratch;
+
+        /// @brief Advances the read position past the next delimiter, scanning the Stream buffer in bulk.
+        /// @remarks The eof bit is set on the Stream if it ends before the delimiter is found.
+        /// @param Delim The character to stop after.
+        /// @param Collected If not nullptr, the characters before the delimiter are appended to it.
+        /// @return Returns the number of characters consumed, including the delimiter if it was found.
+        StreamSize ScanUntil(const Char8 Delim, String* Collected);
+        /// @brief Skips whitespace and gets a view of the number token that follows.
+        /// @remarks A number token is a run of letters, digits, signs and decimal points. If the token is complete
+        /// in the buffer of the Stream the view points into it. Otherwise the token is consumed into a buffer
+        /// owned by this reader. If no token is found the fail bit is set on the Stream.
+        /// @return Returns a view of the token, which is empty if none was found.
+        StringView PeekNumberToken();
+        /// @brief Finishes reading a token returned by PeekNumberToken.
+        /// @param Token The token that was returned by PeekNumberToken.
+        /// @remarks The token is consumed even if it couldn't be parsed, so reading can resume after clearing the
+        /// error.
+        /// @param Parsed The number of characters of the token that were parsed. The fail bit is set on the Stream
+        /// if this isn't the whole token.
+        /// @return Returns true if the whole token was parsed, false otherwise.
+        Boole ConsumeNumberToken(const StringView Token, const size_t Parsed);
+        /// @brief Parses a number from the read position of the Stream.
+        /// @tparam Number The arithmetic type to parse.
+        /// @tparam Parser A callable with the signature of std::from_chars for Number.
+        /// @param Parse The function that converts the characters of the token.
+        /// @return Returns the parsed number, or 0 if the token wasn't a valid Number.
+        template<typename Number, typename Parser>
+        Number ParseNumber(Parser Parse)
+        {
+            StringView Token = this->PeekNumberToken();
+            // from_chars doesn't accept an explicit plus sign, but the stream operators do.
+            const size_t Skipped = ( Token.size() > 1 && Token[0] == '+' && Token[1] != '-' ? 1 : 0 );
+            Number Value{};
+            const Char8* First = Token.data() + Skipped;
+            const std::from_chars_result Result = Parse(First,Token.data() + Token.size(),Value);
+            const size_t Parsed = ( Result.ec == std::errc() ? static_cast<size_t>(Result.ptr - Token.data()) : 0 );
+            if( !this->ConsumeNumberToken(Token,Parsed) ) {
+                return Number{};
+            }
+            return Value;
+        }
     public:
+        ///////////////////////////////////////////////////////////////////////////////
+        /// @brief An input iterator over the lines of a Stream.
+        /// @remarks Each line is a view that is only valid until the iterator is advanced.
+        ///////////////////////////////////////
+        class LineIterator
+        {
+        protected:
+            /// @brief The reader to get lines from, or nullptr once the lines have run out.
+            TextStreamReader* Reader = nullptr;
+            /// @brief The current line.
+            StringView Line;
+            /// @brief The character that ends each line.
+            Char8 Delim = '\n';
+        public:
+            /// @brief The category of this iterator.
+            using iterator_category = std::input_iterator_tag;
+            /// @brief The type of value this iterator yields.
+            using value_type = StringView;
+            /// @brief The type used for distances between iterators.
+            using difference_type = std::ptrdiff_t;
+            /// @brief A pointer to the yielded value.
+            using pointer = const StringView*;
+            /// @brief A reference to the yielded value.
+            using reference = const StringView&;
+
+            /// @brief End constructor.
+            LineIterator() = default;
+            /// @brief Reader constructor.
+            /// @param Source The reader to get lines from. The first line is read immediately.
+            /// @param Delimiter The character that ends each line.
+            LineIterator(TextStreamReader* Source, const Char8 Delimiter) :
+                Reader(Source),
+                Delim(Delimiter)
+                { ++(*this); }
+
+            /// @brief Gets the current line.
+            /// @return Returns a view of the current line, without the delimiter.
+            [[nodiscard]] reference operator*() const
+                { return this->Line; }
+            /// @brief Gets the current line.
+            /// @return Returns a pointer to a view of the current line.
+            [[nodiscard]] pointer operator->() const
+                { return &this->Line; }
+            /// @brief Advances to the next line.
+            /// @return Returns a reference to this.
+            LineIterator& operator++()
+            {
+                if( !this->Reader->ReadLineView(this->Line,this->Delim) ) {
+                    this->Reader = nullptr;
+                }
+                return *this;
+            }
+            /// @brief Compares two iterators.
+            /// @remarks Iterators are only equal when both have reached the end.
+            /// @param Other The other iterator to compare to.
+            /// @return Returns true if both iterators refer to the same reader, false otherwise.
+            [[nodiscard]] Boole operator==(const LineIterator& Other) const
+                { return this->Reader == Other.Reader; }
+            /// @brief Compares two iterators.
+            /// @param Other The other iterator to compare to.
+            /// @return Returns true if the iterators refer to different readers, false otherwise.
+            [[nodiscard]] Boole operator!=(const LineIterator& Other) const
+                { return this->Reader != Other.Reader; }
+        };//LineIterator
+
+        ///////////////////////////////////////////////////////////////////////////////
+        /// @brief A range over the remaining lines of a Stream, for use in a range-for loop.
+        ///////////////////////////////////////
+        class LineRange
+        {
+        protected:
+            /// @brief The reader to get lines from.
+            TextStreamReader* Reader;
+            /// @brief The character that ends each line.
+            Char8 Delim;
+        public:
+            /// @brief Class constructor.
+            /// @param Source The reader to get lines from.
+            /// @param Delimiter The character that ends each line.
+            LineRange(TextStreamReader* Source, const Char8 Delimiter) :
+                Reader(Source),
+                Delim(Delimiter)
+                {  }
+
+            /// @brief Gets an iterator to the first remaining line.
+            /// @remarks This reads from the Stream, so it should only be called once.
+            /// @return Returns an iterator to the first line read.
+            [[nodiscard]] LineIterator begin() const
+                { return LineIterator(this->Reader,this->Delim); }
+            /// @brief Gets an iterator marking the end of the lines.
+            /// @return Returns an end iterator.
+            [[nodiscard]] LineIterator end() const
+                { return LineIterator(); }
+        };//LineRange
+
         /// @brief Stream constructor.
         /// @param Input The Stream to read from.
         TextStreamReader(StdInputStreamPtr Input);
@@ -77,6 +224,85 @@ namespace Mezzanine
         /// @param Delim The character to stop at when reading the Stream.
         /// @return Returns a String with all characters from the read position to (but not including) the delimiter.
         [[nodiscard]] String ReadLine(const Char8 Delim = '\n');
+        /// @brief Reads characters from the Stream until the delimiter is found, without allocating.
+        /// @remarks The Stream position is advanced the same as with ReadLine. When the whole line is in the buffer
+        /// of the Stream the view points straight into it. Otherwise the line is copied to a buffer owned and
+        /// reused by this reader. Either way the view is only valid until the next operation on this reader or
+        /// the Stream.
+        /// @param Line Set to a view of the line read, without the delimiter.
+        /// @param Delim The character to stop at when reading the Stream.
+        /// @return Returns true if a line was read, or false if the Stream was already at its end or not valid.
+        Boole ReadLineView(StringView& Line, const Char8 Delim = '\n');
+        /// @brief Gets a range over the remaining lines of the Stream.
+        /// @remarks Lines are read with ReadLineView, so iterating doesn't allocate for each line.
+        /// @param Delim The character that ends each line.
+        /// @return Returns a range to use in a range-for loop.
+        [[nodiscard]] LineRange ReadLines(const Char8 Delim = '\n');
+        /// @brief Reads an integer written in text, skipping any whitespace before it.
+        /// @remarks The number is parsed straight from the buffer of the Stream without the locale and without
+        /// allocating. The whole token must be a number, so "12abc" is an error. On an error the token is skipped,
+        /// the fail bit is set on the Stream and 0 is returned.
+        /// @tparam Integer The integral type to read.
+        /// @param Base The base the integer is written in, from 2 to 36.
+        /// @return Returns the integer read.
+        template<typename Integer, typename = std::enable_if_t< std::is_integral_v<Integer> && !std::is_same_v<Integer,bool> >>
+        [[nodiscard]] Integer ReadInteger(const int Base = 10)
+        {
+            return this->ParseNumber<Integer>([Base](const Char8* First, const Char8* Last, Integer& Value) {
+                return std::from_chars(First,Last,Value,Base);
+            });
+        }
+        /// @brief Reads a floating point number written in text, skipping any whitespace before it.
+        /// @remarks Fixed and scientific notation, inf and nan are accepted. Errors are handled the same as
+        /// ReadInteger. Where the standard library lacks floating point from_chars, strtod and its siblings are
+        /// used instead, which depend on the current C locale.
+        /// @tparam Float The floating point type to read.
+        /// @return Returns the number read.
+        template<typename Float, typename = std::enable_if_t< std::is_floating_point_v<Float> >>
+        [[nodiscard]] Float ReadFloat()
+        {
+            return this->ParseNumber<Float>([](const Char8* First, const Char8* Last, Float& Value) {
+            #if defined(__cpp_lib_to_chars)
+                return std::from_chars(First,Last,Value,std::chars_format::general);
+            #else
+                // The strto family needs a terminated string.
+                const String Terminated(First,Last);
+                Char8* End = nullptr;
+                if constexpr( std::is_same_v<Float,float> ) {
+                    Value = std::strtof(Terminated.c_str(),&End);
+                }else if constexpr( std::is_same_v<Float,double> ) {
+                    Value = std::strtod(Terminated.c_str(),&End);
+                }else{
+                    Value = std::strtold(Terminated.c_str(),&End);
+                }
+                const Boole Valid = ( End != Terminated.c_str() );
+                return std::from_chars_result{ First + ( End - Terminated.c_str() ),
+                                               ( Valid ? std::errc() : std::errc::invalid_argument ) };
+            #endif
+            });
+        }
+        /// @brief Reads a sequence of whitespace separated numbers.
+        /// @remarks Reading stops at the first error, which sets the fail bit on the Stream.
+        /// @tparam Number The arithmetic type to read.
+        /// @param Values The array to populate with the numbers read.
+        /// @param Count The number of numbers to read.
+        /// @return Returns the number of numbers successfully read.
+        template<typename Number, typename = std::enable_if_t< std::is_arithmetic_v<Number> >>
+        size_t ReadNumbers(Number* Values, const size_t Count)
+        {
+            for( size_t Index = 0 ; Index < Count ; ++Index )
+            {
+                if constexpr( std::is_floating_point_v<Number> ) {
+                    Values[Index] = this->ReadFloat<Number>();
+                }else{
+                    Values[Index] = this->ReadInteger<Number>();
+                }
+                if( this->Stream->fail() ) {
+                    return Index;
+                }
+            }
+            return Count;
+        }
         /// @brief Reads a single character from the Stream.
         /// @remarks This will also advance the Stream position by 1 byte.
         /// @return Returns the character at the current read position, or a null terminator if the Stream is at EoF.
@@ -87,11 +313,22 @@ namespace Mezzanine
         /// @return The number of bytes actually skipped in the Stream.
         StreamSize Skip(const StreamSize Bytes);
 
+        /// @brief Advances the read position past the next occurrence of a delimiter.
+        /// @remarks The skipped characters are scanned in place in the buffer of the Stream and are never copied.
+        /// If the delimiter isn't found the Stream is left at its end.
+        /// @param Delim The character to stop after.
+        /// @return Returns the number of characters skipped, including the delimiter if it was found.
+        StreamSize SkipUntil(const Char8 Delim = '\n');
+
         /// @brief Reads the entire Stream and places it into a String.
         /// @remarks This function reads the entire Stream from start to finish. The read position will be saved,
         /// then set to the beginning of the Stream, advanced to the end, and then set back to the same read
         /// position the Stream was at when this function was called.
         /// @n @n
+        /// The size of the Stream is taken from the Stream itself when it knows it, so the contents are usually
+        /// read in a single transfer. Streams that can't seek are read from the current read position to their
+        /// end, growing the String geometrically, and the read position is left at the end.
+        /// @n @n
         /// This might produce a very large String. Be mindful of the Streams size when using this.
         /// @return Returns a String containing the entire contents of the Stream.
         /// @throw If the underlying stream has issues this can throw a Mezzanine::Exception::StreamReadError .
@@ -100,6 +337,7 @@ namespace Mezzanine
         /// @return Returns true if the Stream has reached EoF, false otherwise.
         [[nodiscard]] Boole AtEnd() const;
     };//TextStreamReader
+    RESTORE_WARNING_STATE
 }//Mezzanine
 
 #endif
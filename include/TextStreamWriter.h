@@ -42,24 +42,95 @@
 
 #ifndef SWIG
     #include "OutputStream.h"
+
+    #include <charconv>
+    #include <cstdio>
+    #include <limits>
+    #include <type_traits>
+    #include <vector>
 #endif
 
 namespace Mezzanine
 {
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief An output Stream (in text mode) helper class for safer streaming.
+    /// @details Small writes go straight into the buffer of the Stream when it has room, skipping the sentry
+    /// and virtual calls of the Stream. A writer can also be given a buffer of its own, which collects writes
+    /// and hands them to the Stream in bulk. That helps when the Stream has no buffer of its own, but means
+    /// written data only reaches the Stream once the buffer fills, Flush is called, or the writer is destroyed.
     ///////////////////////////////////////
     class MEZZ_LIB TextStreamWriter
     {
+    public:
+        /// @brief The most characters any number can be written as.
+        static constexpr size_t MaxNumberLength = 64;
     protected:
         /// @brief A pointer to the Stream being written to.
         StdOutputStreamPtr Stream;
+        /// @brief The storage for writes not yet handed to the Stream. Empty if this writer doesn't buffer.
+        std::vector<Char8> Buffer;
+        /// @brief The number of characters in the buffer waiting to be handed to the Stream.
+        size_t Used = 0;
+
+        /// @brief Gets space to write characters into without going through the Stream.
+        /// @param Size The number of characters that will be written at most.
+        /// @return Returns a pointer into the buffer of this writer or of the Stream, or nullptr if there isn't
+        /// room and a normal write is needed.
+        Char8* ReserveSpace(const size_t Size);
+        /// @brief Finishes a write into space returned by ReserveSpace.
+        /// @param Size The number of characters actually written.
+        void CommitSpace(const size_t Size);
+        /// @brief Writes characters through the buffer of this writer.
+        /// @param Data The characters to write.
+        /// @param Size The number of characters to write.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        Boole WriteData(const Char8* Data, const size_t Size);
+        /// @brief Hands anything waiting in the buffer of this writer to the Stream.
+        void WriteBuffer();
+
+        /// @brief Formats a number as text.
+        /// @tparam Number The type of number to format.
+        /// @param Dest The buffer to format into. Must have room for MaxNumberLength characters.
+        /// @param Value The number to format.
+        /// @return Returns the number of characters written.
+        template<typename Number>
+        static size_t FormatNumber(Char8* Dest, const Number Value) noexcept
+        {
+            if constexpr( std::is_integral_v<Number> ) {
+                return static_cast<size_t>( std::to_chars(Dest,Dest + MaxNumberLength,Value).ptr - Dest );
+            }else{
+            #if defined(__cpp_lib_to_chars)
+                return static_cast<size_t>( std::to_chars(Dest,Dest + MaxNumberLength,Value).ptr - Dest );
+            #else
+                // Enough digits to read back the same value, though not always the fewest digits that would.
+                int Length = 0;
+                if constexpr( std::is_same_v<Number,long double> ) {
+                    Length = std::snprintf(Dest,MaxNumberLength,"%.*Lg",std::numeric_limits<Number>::max_digits10,Value);
+                }else{
+                    Length = std::snprintf(Dest,MaxNumberLength,"%.*g",std::numeric_limits<Number>::max_digits10,static_cast<double>(Value));
+                }
+                return ( Length > 0 ? static_cast<size_t>(Length) : 0 );
+            #endif
+            }
+        }
     public:
         /// @brief Stream constructor.
         /// @param Output The Stream to read from.
-        TextStreamWriter(StdOutputStreamPtr Output);
+        /// @param BufferSize The size of the buffer to collect writes in, or 0 to hand every write to the Stream
+        /// right away.
+        TextStreamWriter(StdOutputStreamPtr Output, const size_t BufferSize = 0);
+        /// @brief Deleted copy constructor.
+        /// @remarks Copies would each write out the same buffered data.
+        TextStreamWriter(const TextStreamWriter&) = delete;
         /// @brief Class destructor.
-        ~TextStreamWriter() = default;
+        /// @remarks Hands anything left in the buffer of this writer to the Stream.
+        ~TextStreamWriter();
+
+        /// @brief Deleted copy assignment operator.
+        /// @remarks Copies would each write out the same buffered data.
+        TextStreamWriter& operator=(const TextStreamWriter&) = delete;
 
         ///////////////////////////////////////////////////////////////////////////////
         // Writing
@@ -73,7 +144,31 @@ namespace Mezzanine
         /// @param ToWrite The character to write to the Stream.
         /// @return Returns true if the Stream is still in a valid state after the Write.
         Boole Write(const Char8 ToWrite);
+        /// @brief Writes a number to the Stream as text.
+        /// @remarks Numbers are formatted with std::to_chars straight into the buffer being written to, without
+        /// the locale. Integers are written in base 10 and floats in the shortest form that reads back as the
+        /// same value. Where the standard library lacks floating point to_chars, snprintf is used instead.
+        /// @tparam Number The integral or floating point type to write. Characters and bools are excluded.
+        /// @param ToWrite The number to write to the Stream.
+        /// @return Returns true if the Stream is still in a valid state after the Write.
+        template<typename Number, typename = std::enable_if_t< std::is_arithmetic_v<Number> &&
+                                                               !std::is_same_v<Number,bool> &&
+                                                               !std::is_same_v<Number,Char8> >>
+        Boole Write(const Number ToWrite)
+        {
+            if( Char8* Space = this->ReserveSpace(MaxNumberLength) ) {
+                this->CommitSpace( FormatNumber(Space,ToWrite) );
+                return this->Stream->good();
+            }
+            Char8 Formatted[MaxNumberLength];
+            return this->WriteData(Formatted,FormatNumber(Formatted,ToWrite));
+        }
+
+        /// @brief Hands anything in the buffer of this writer to the Stream and flushes the Stream.
+        /// @return Returns true if the Stream is still in a valid state after the Flush.
+        Boole Flush();
     };//TextStreamWriter
+    RESTORE_WARNING_STATE
 }//Mezzanine
 
 #endif
@@ -0,0 +1,216 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_UnicodeStream_h
+#define Mezz_IOStreams_UnicodeStream_h
+
+/// @file
+/// @brief This file contains streambufs that validate UTF-8 and transcode between UTF-16 and UTF-8.
+
+#ifndef SWIG
+    #include "BufferPool.h"
+    #include "StreamBase.h"
+    #include "UnicodeTools.h"
+#endif
+
+namespace Mezzanine
+{
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+    SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A streambuf that passes through UTF-8 from another streambuf, checking it as it goes.
+    /// @details Text is read from the source a buffer at a time and only the part that is valid is handed out.
+    /// A character cut off by the end of a read is held back until the rest of it arrives. When invalid data
+    /// is found everything before it is still handed out, and then the buffer reports the end of the Stream.
+    /// IsValid can then be used to tell an early stop apart from a real end.
+    ///////////////////////////////////////
+    class MEZZ_LIB Utf8ValidatingBuffer : public std::streambuf
+    {
+    protected:
+        /// @brief The streambuf being read from.
+        std::streambuf* Source;
+        /// @brief The storage for the get area.
+        BufferPool::BufferPtr Buffer;
+        /// @brief The number of bytes the get area storage can hold.
+        size_t BufferSize;
+        /// @brief The offset in the storage of the bytes of a cut off character.
+        size_t HeldStart = 0;
+        /// @brief The number of bytes of a cut off character waiting for the rest of it.
+        size_t HeldCount = 0;
+        /// @brief The number of bytes that have passed validation.
+        StreamSize Validated = 0;
+        /// @brief Whether all of the text read so far was valid.
+        Boole Valid = true;
+    public:
+        /// @brief The default size of the get area.
+        static constexpr size_t DefaultBufferSize = 64 * 1024;
+
+        /// @brief Class constructor.
+        /// @param ToRead The streambuf to read UTF-8 from. Must outlive this buffer.
+        /// @param BufSize The size of the get area.
+        Utf8ValidatingBuffer(std::streambuf* ToRead, const size_t BufSize = DefaultBufferSize);
+        /// @brief Class destructor.
+        virtual ~Utf8ValidatingBuffer() = default;
+
+        /// @brief Gets whether the text read so far was valid.
+        /// @return Returns false if invalid UTF-8 was found, or if the source ended partway through a character.
+        [[nodiscard]] Boole IsValid() const noexcept;
+        /// @brief Gets the number of bytes that passed validation.
+        /// @remarks Once IsValid returns false this is the offset of the invalid data in the source.
+        /// @return Returns the number of bytes validated so far, including those not yet read from this buffer.
+        [[nodiscard]] StreamSize GetValidatedCount() const noexcept;
+
+        /// @copydoc std::streambuf::underflow()
+        int_type underflow() override;
+    };//Utf8ValidatingBuffer
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A streambuf that reads UTF-16 from another streambuf and hands it out as UTF-8.
+    /// @details A byte order mark at the start of the source selects the byte order it names and is dropped.
+    /// Without one the byte order given to the constructor is used. Lone surrogates stop reading the same way
+    /// invalid data does in Utf8ValidatingBuffer.
+    ///////////////////////////////////////
+    class MEZZ_LIB Utf16InputBuffer : public std::streambuf
+    {
+    protected:
+        /// @brief The streambuf being read from.
+        std::streambuf* Source;
+        /// @brief The storage for UTF-16 read from the source.
+        BufferPool::BufferPtr RawBuffer;
+        /// @brief The storage for the get area.
+        BufferPool::BufferPtr TextBuffer;
+        /// @brief The number of bytes of UTF-16 read at a time.
+        size_t BufferSize;
+        /// @brief The offset in the UTF-16 storage of the bytes waiting for the rest of their character.
+        size_t HeldStart = 0;
+        /// @brief The number of bytes of UTF-16 waiting for the rest of their character.
+        size_t HeldCount = 0;
+        /// @brief The byte order of the source.
+        ByteOrder Order;
+        /// @brief Whether all of the text read so far was valid.
+        Boole Valid = true;
+        /// @brief Whether the start of the source still needs to be checked for a byte order mark.
+        Boole CheckMark = true;
+    public:
+        /// @brief The default number of bytes of UTF-16 to read at a time.
+        static constexpr size_t DefaultBufferSize = 64 * 1024;
+
+        /// @brief Class constructor.
+        /// @param ToRead The streambuf to read UTF-16 from. Must outlive this buffer.
+        /// @param SourceOrder The byte order of the source if it does not start with a byte order mark.
+        /// @param BufSize The number of bytes of UTF-16 to read at a time.
+        Utf16InputBuffer(std::streambuf* ToRead, const ByteOrder SourceOrder, const size_t BufSize = DefaultBufferSize);
+        /// @brief Class destructor.
+        virtual ~Utf16InputBuffer() = default;
+
+        /// @brief Gets the byte order of the source.
+        /// @return Returns the byte order named by the byte order mark, or the one given to the constructor.
+        [[nodiscard]] ByteOrder GetByteOrder() const noexcept;
+        /// @brief Gets whether the text read so far was valid.
+        /// @return Returns false if a lone surrogate was found, or if the source ended partway through a character.
+        [[nodiscard]] Boole IsValid() const noexcept;
+
+        /// @copydoc std::streambuf::underflow()
+        int_type underflow() override;
+    };//Utf16InputBuffer
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A streambuf that is written UTF-8 and writes it on to another streambuf as UTF-16.
+    /// @details Text is collected in the put area and converted each time it fills or is synced. A character
+    /// cut off by the end of the put area is kept until the rest of it is written. Once invalid UTF-8 is
+    /// written nothing further is converted, and writes fail.
+    ///////////////////////////////////////
+    class MEZZ_LIB Utf16OutputBuffer : public std::streambuf
+    {
+    protected:
+        /// @brief The streambuf being written to.
+        std::streambuf* Destination;
+        /// @brief The storage for the put area.
+        BufferPool::BufferPtr TextBuffer;
+        /// @brief The storage for converted UTF-16.
+        BufferPool::BufferPtr RawBuffer;
+        /// @brief The number of bytes the put area storage can hold.
+        size_t BufferSize;
+        /// @brief The byte order to write in.
+        ByteOrder Order;
+        /// @brief Whether all of the text written so far was valid.
+        Boole Valid = true;
+        /// @brief Whether a byte order mark still needs to be written.
+        Boole MarkPending;
+
+        /// @brief Converts and writes the contents of the put area.
+        /// @return Returns true if the text was valid and written, false otherwise.
+        Boole FlushText();
+    public:
+        /// @brief The default size of the put area.
+        static constexpr size_t DefaultBufferSize = 64 * 1024;
+
+        /// @brief Class constructor.
+        /// @param ToWrite The streambuf to write UTF-16 to. Must outlive this buffer.
+        /// @param DestOrder The byte order to write in.
+        /// @param WriteMark Whether to start the output with a byte order mark.
+        /// @param BufSize The size of the put area.
+        Utf16OutputBuffer(std::streambuf* ToWrite,
+                          const ByteOrder DestOrder,
+                          const Boole WriteMark = false,
+                          const size_t BufSize = DefaultBufferSize);
+        /// @brief Class destructor.
+        /// @remarks Converts and writes any complete characters still in the put area.
+        virtual ~Utf16OutputBuffer();
+
+        /// @brief Gets the byte order being written.
+        /// @return Returns the byte order given to the constructor.
+        [[nodiscard]] ByteOrder GetByteOrder() const noexcept;
+        /// @brief Gets whether the text written so far was valid.
+        /// @remarks Only text that has been converted is checked, so sync first for an up to date answer.
+        /// @return Returns false if invalid UTF-8 was written.
+        [[nodiscard]] Boole IsValid() const noexcept;
+
+        /// @copydoc std::streambuf::overflow(int_type)
+        int_type overflow(int_type Character) override;
+        /// @copydoc std::streambuf::sync()
+        int sync() override;
+    };//Utf16OutputBuffer
+
+    RESTORE_WARNING_STATE
+}//Mezzanine
+
+#endif
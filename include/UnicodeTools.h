@@ -0,0 +1,119 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_UnicodeTools_h
+#define Mezz_IOStreams_UnicodeTools_h
+
+/// @file
+/// @brief This file contains utilities for validating UTF-8 and converting between UTF-8 and UTF-16.
+
+#ifndef SWIG
+    #include "EndianTools.h"
+#endif
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A collection of functions for validating and transcoding Unicode text.
+    /// @details Runs of ASCII are checked and converted 16 or 32 bytes at a time with SSE2, AVX2 or NEON when the
+    /// build targets them. Everything else goes through a scalar decoder that enforces the well-formed byte
+    /// sequences of the Unicode standard, rejecting overlong forms, surrogates and code points past U+10FFFF.
+    ///
+    /// All functions work on buffers that may end partway through a character, so that they can be used on
+    /// Stream buffers a chunk at a time. They stop before a character that is cut off by the end of the buffer,
+    /// and the caller can carry the unconsumed bytes over to the next chunk.
+    ///////////////////////////////////////
+    namespace UnicodeTools
+    {
+        /// @brief The outcome of transcoding a buffer.
+        struct TranscodeResult
+        {
+            /// @brief The number of bytes of the source that were consumed.
+            size_t Read = 0;
+            /// @brief The number of bytes written to the destination.
+            size_t Written = 0;
+            /// @brief Whether the source was well formed. If false, Read is the offset of the invalid data.
+            Boole Valid = true;
+        };//TranscodeResult
+
+        /// @brief Gets the space needed to convert UTF-16 to UTF-8.
+        /// @param Utf16Bytes The number of bytes of UTF-16 to convert.
+        /// @return Returns the most bytes of UTF-8 that many bytes of UTF-16 can produce.
+        [[nodiscard]] constexpr size_t GetUtf8Capacity(const size_t Utf16Bytes) noexcept
+            { return ( Utf16Bytes / 2 ) * 3; }
+        /// @brief Gets the space needed to convert UTF-8 to UTF-16.
+        /// @param Utf8Bytes The number of bytes of UTF-8 to convert.
+        /// @return Returns the most bytes of UTF-16 that many bytes of UTF-8 can produce.
+        [[nodiscard]] constexpr size_t GetUtf16Capacity(const size_t Utf8Bytes) noexcept
+            { return Utf8Bytes * 2; }
+
+        /// @brief Finds where the valid UTF-8 at the start of a buffer ends.
+        /// @param Begin The start of the text to check.
+        /// @param End One past the end of the text to check.
+        /// @return Returns End if the whole buffer is valid, otherwise the start of the first sequence that is
+        /// invalid or cut off by End.
+        [[nodiscard]] MEZZ_LIB const Char8* ValidateUtf8(const Char8* Begin, const Char8* End) noexcept;
+        /// @brief Checks if a buffer holds the start of a UTF-8 sequence that was cut off.
+        /// @param Begin The start of the bytes to check.
+        /// @param End One past the end of the bytes to check.
+        /// @return Returns true if the bytes are a valid sequence missing only its last bytes, false otherwise.
+        [[nodiscard]] MEZZ_LIB Boole IsIncompleteUtf8(const Char8* Begin, const Char8* End) noexcept;
+
+        /// @brief Converts UTF-16 to UTF-8.
+        /// @remarks Stops early at a trailing odd byte or a high surrogate without its pair, leaving them unread
+        /// but still reporting the source as valid. A lone surrogate is invalid.
+        /// @param Source The UTF-16 to convert.
+        /// @param Length The number of bytes of UTF-16.
+        /// @param Order The byte order of the UTF-16.
+        /// @param Dest The buffer to write UTF-8 to. Must have room for GetUtf8Capacity(Length) bytes.
+        /// @return Returns how much was read and written, and whether the source was valid.
+        MEZZ_LIB TranscodeResult Utf16ToUtf8(const Char8* Source, const size_t Length, const ByteOrder Order, Char8* Dest) noexcept;
+        /// @brief Converts UTF-8 to UTF-16.
+        /// @remarks Stops early at a trailing sequence that is cut off, leaving it unread but still reporting the
+        /// source as valid.
+        /// @param Source The UTF-8 to convert.
+        /// @param Length The number of bytes of UTF-8.
+        /// @param Order The byte order to write the UTF-16 in.
+        /// @param Dest The buffer to write UTF-16 to. Must have room for GetUtf16Capacity(Length) bytes.
+        /// @return Returns how much was read and written, and whether the source was valid.
+        MEZZ_LIB TranscodeResult Utf8ToUtf16(const Char8* Source, const size_t Length, const ByteOrder Order, Char8* Dest) noexcept;
+    }//UnicodeTools
+}//Mezzanine
+
+#endif
@@ -0,0 +1,119 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_VarIntTools_h
+#define Mezz_IOStreams_VarIntTools_h
+
+/// @file
+/// @brief This file contains utilities for encoding integers in a variable number of bytes.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+#endif
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A collection of functions for variable length integer encodings.
+    /// @details Two encodings are provided. LEB128 varints store 7 bits per byte, with the high bit set on every
+    /// byte except the last, and suit single values. Stream VByte stores arrays of 32-bit values as a block of
+    /// 2-bit length codes followed by the value bytes. That layout lets the decoder expand four values at a
+    /// time with a byte shuffle.
+    ///////////////////////////////////////
+    namespace VarIntTools
+    {
+        /// @brief The most bytes a 64-bit varint can take.
+        constexpr size_t MaxVarIntSize = 10;
+
+        /// @brief Maps a signed value to an unsigned value so that values near zero encode in few bytes.
+        /// @param Value The signed value to map.
+        /// @return Returns 0 for 0, 1 for -1, 2 for 1, 3 for -2, and so on.
+        [[nodiscard]] constexpr UInt64 ZigZagEncode(const Int64 Value) noexcept
+            { return ( static_cast<UInt64>(Value) << 1 ) ^ static_cast<UInt64>( Value >> 63 ); }
+        /// @brief Reverses ZigZagEncode.
+        /// @param Value The unsigned value to map.
+        /// @return Returns the original signed value.
+        [[nodiscard]] constexpr Int64 ZigZagDecode(const UInt64 Value) noexcept
+            { return static_cast<Int64>( ( Value >> 1 ) ^ ( ~( Value & 1 ) + 1 ) ); }
+
+        /// @brief Encodes a value as a LEB128 varint.
+        /// @param Value The value to encode.
+        /// @param Out The buffer to write to. Must have room for at least MaxVarIntSize bytes.
+        /// @return Returns the number of bytes written.
+        MEZZ_LIB size_t EncodeVarInt(UInt64 Value, UInt8* Out) noexcept;
+        /// @brief Decodes a LEB128 varint.
+        /// @param In The buffer to read from.
+        /// @param Available The number of bytes that can be read from In.
+        /// @param Value Set to the decoded value on success.
+        /// @return Returns the number of bytes consumed, or 0 if the varint was incomplete or too large.
+        MEZZ_LIB size_t DecodeVarInt(const UInt8* In, const size_t Available, UInt64& Value) noexcept;
+
+        /// @brief Gets the most bytes an array of values can take when encoded with Stream VByte.
+        /// @param Count The number of values.
+        /// @return Returns the size of the length codes plus the largest possible size of the values.
+        [[nodiscard]] constexpr size_t StreamVByteMaxSize(const size_t Count) noexcept
+            { return ( Count + 3 ) / 4 + Count * 4; }
+        /// @brief Gets the size of the length codes of an array encoded with Stream VByte.
+        /// @param Count The number of values.
+        /// @return Returns the number of bytes of length codes that precede the values.
+        [[nodiscard]] constexpr size_t StreamVByteControlSize(const size_t Count) noexcept
+            { return ( Count + 3 ) / 4; }
+        /// @brief Gets the size of the values of an array encoded with Stream VByte.
+        /// @param Control The length codes of the array.
+        /// @param Count The number of values.
+        /// @return Returns the number of bytes of values that follow the length codes.
+        [[nodiscard]] MEZZ_LIB size_t StreamVByteDataSize(const UInt8* Control, const size_t Count) noexcept;
+        /// @brief Encodes an array of values with Stream VByte.
+        /// @param In The values to encode.
+        /// @param Count The number of values.
+        /// @param Out The buffer to write to. Must have room for StreamVByteMaxSize(Count) bytes.
+        /// @return Returns the number of bytes written.
+        MEZZ_LIB size_t StreamVByteEncode(const UInt32* In, const size_t Count, UInt8* Out) noexcept;
+        /// @brief Decodes an array of values encoded with Stream VByte.
+        /// @remarks Uses an SSSE3 or AArch64 NEON shuffle per four values when the build targets them, and a
+        /// scalar loop otherwise.
+        /// @param In The encoded array, starting with the length codes.
+        /// @param Count The number of values.
+        /// @param Out The array to write the values to.
+        /// @return Returns the number of bytes consumed.
+        MEZZ_LIB size_t StreamVByteDecode(const UInt8* In, const size_t Count, UInt32* Out) noexcept;
+    }//VarIntTools
+}//Mezzanine
+
+#endif
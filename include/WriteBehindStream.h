@@ -0,0 +1,283 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_WriteBehindStream_h
+#define Mezz_IOStreams_WriteBehindStream_h
+
+/// @file
+/// @brief This file contains the streambuf and Stream classes for writing data out on another thread.
+
+#ifndef SWIG
+    #include "BufferPool.h"
+    #include "OutputStream.h"
+
+    #include <condition_variable>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+#endif
+
+namespace Mezzanine
+{
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wpadded")
+    SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A write-only streambuf that hands full buffers to a background thread to be written.
+    /// @details Writes are collected into fixed size blocks. When a block fills, or the buffer is synced, the
+    /// block is queued for a flusher thread to write to the destination streambuf and writing continues into a
+    /// free block. Only when every block is queued does a writer have to wait, which bounds the memory used.
+    /// @n @n
+    /// Syncing this buffer does not wait for data to reach the destination. Use WaitForWrites when the data
+    /// needs to have been written, for example before reading it back or handing the file to something else.
+    /// @n @n
+    /// The destination streambuf must not be used by anything else while it is attached to this buffer.
+    ///////////////////////////////////////
+    class MEZZ_LIB WriteBehindBuffer : public std::streambuf
+    {
+    public:
+        /// @brief The number of bytes in each block if no other size is specified.
+        static constexpr StreamSize DefaultBlockSize = 64 * 1024;
+        /// @brief The number of blocks to use if no other count is specified.
+        static constexpr size_t DefaultBlockCount = 4;
+    protected:
+        /// @brief A single block of data waiting to be written.
+        struct WriteBlock
+        {
+            /// @brief The data to be written.
+            BufferPool::BufferPtr Data;
+            /// @brief The number of valid bytes in the Data.
+            StreamSize Size = 0;
+        };//WriteBlock
+
+        /// @brief Storage for every block used by this buffer.
+        std::vector<WriteBlock> Blocks;
+        /// @brief Blocks waiting to be written, in Stream order.
+        std::deque<WriteBlock*> QueuedBlocks;
+        /// @brief Blocks that are available to be written into.
+        std::vector<WriteBlock*> FreeBlocks;
+        /// @brief The thread writing blocks to the destination.
+        std::thread Flusher;
+        /// @brief Mutex protecting the block lists and state shared with the flusher thread.
+        std::mutex BlockLock;
+        /// @brief Condition used to signal changes to the block lists and state.
+        std::condition_variable BlockCondition;
+        /// @brief The streambuf data is being written to.
+        std::streambuf* Destination = nullptr;
+        /// @brief The block currently exposed as the put area.
+        WriteBlock* Current = nullptr;
+        /// @brief The position in the destination the put area starts at.
+        StreamOff CurrentStart = 0;
+        /// @brief The largest position in the destination that has been written to, or will be.
+        StreamOff EndPosition = 0;
+        /// @brief The number of bytes in each block.
+        StreamSize BlockSize;
+        /// @brief Whether or not the flusher thread is writing to the destination right now.
+        Boole Writing = false;
+        /// @brief Whether or not a write to the destination has failed.
+        Boole Failed = false;
+        /// @brief Whether or not the flusher thread should exit.
+        Boole ShuttingDown = false;
+
+        /// @brief The function run by the flusher thread.
+        void FlushData();
+        /// @brief Starts the flusher thread.
+        void StartFlusher();
+        /// @brief Waits for every queued block to be written and stops the flusher thread.
+        void StopFlusher();
+        /// @brief Queues the current block if it has data, and makes sure a block is available for writing.
+        /// @remarks This will block if there are no free blocks until one has been written.
+        /// @param Lock A lock on the BlockLock.
+        /// @return Returns false if a previous write to the destination has failed, true otherwise.
+        Boole SubmitBlock(std::unique_lock<std::mutex>& Lock);
+        /// @brief Queues the current block and waits for every queued block to be written.
+        /// @param Lock A lock on the BlockLock.
+        /// @return Returns false if a write to the destination has failed, true otherwise.
+        Boole DrainBlocks(std::unique_lock<std::mutex>& Lock);
+    public:
+        /// @brief Blank constructor.
+        /// @param Size The number of bytes in each block.
+        /// @param BlockCount The number of blocks to use. At least two will be used.
+        WriteBehindBuffer(const StreamSize Size = DefaultBlockSize, const size_t BlockCount = DefaultBlockCount);
+        /// @brief Destination constructor.
+        /// @param Dest The streambuf to write to.
+        /// @param Size The number of bytes in each block.
+        /// @param BlockCount The number of blocks to use. At least two will be used.
+        WriteBehindBuffer(std::streambuf* Dest,
+                          const StreamSize Size = DefaultBlockSize,
+                          const size_t BlockCount = DefaultBlockCount);
+        /// @brief Copy constructor.
+        /// @param Other The other buffer to not be copied.
+        WriteBehindBuffer(const WriteBehindBuffer& Other) = delete;
+        /// @brief Move constructor.
+        /// @param Other The other buffer to not be moved.
+        WriteBehindBuffer(WriteBehindBuffer&& Other) = delete;
+        /// @brief Class destructor.
+        /// @remarks Blocks until all data written to this buffer has been written to the destination.
+        virtual ~WriteBehindBuffer();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Operators
+
+        /// @brief Copy assignment operator.
+        /// @param Other The other buffer to not be copied.
+        /// @return Returns a reference to this.
+        WriteBehindBuffer& operator=(const WriteBehindBuffer& Other) = delete;
+        /// @brief Move assignment operator.
+        /// @param Other The other buffer to not be moved.
+        /// @return Returns a reference to this.
+        WriteBehindBuffer& operator=(WriteBehindBuffer&& Other) = delete;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Configuration
+
+        /// @brief Sets the streambuf to write to.
+        /// @remarks All data for the previous destination is written before it is detached. Writing will begin
+        /// at the current position of the new destination. While there is no destination writes will fail.
+        /// @param Dest The streambuf to write to, or nullptr to detach the current destination.
+        void SetDestination(std::streambuf* Dest);
+        /// @brief Gets the streambuf being written to.
+        /// @return Returns a pointer to the destination streambuf, or nullptr if there is none.
+        [[nodiscard]] std::streambuf* GetDestination() const noexcept;
+        /// @brief Gets the number of bytes in each block.
+        /// @return Returns the size of the blocks writes are collected into.
+        [[nodiscard]] StreamSize GetBlockSize() const noexcept;
+        /// @brief Gets the number of blocks used by this buffer.
+        /// @return Returns the number of blocks, including the one being written into.
+        [[nodiscard]] size_t GetBlockCount() const noexcept;
+        /// @brief Gets the size of the destination once all pending writes have completed.
+        /// @return Returns the position one past the furthest byte written, or to be written.
+        [[nodiscard]] StreamSize GetEndPosition() const noexcept;
+
+        /// @brief Waits for all data written to this buffer to be written to the destination, and syncs it.
+        /// @return Returns true if all data was successfully written, false otherwise.
+        Boole WaitForWrites();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Internal Buffer Operations
+
+        /// @copydoc std::streambuf::overflow(int_type)
+        int_type overflow(int_type Character) override;
+        /// @copydoc std::streambuf::sync()
+        /// @remarks This queues any buffered data to be written but does not wait for it.
+        int sync() override;
+        /// @copydoc std::streambuf::seekoff(off_type,std::ios_base::seekdir,std::ios_base::openmode)
+        pos_type seekoff(off_type Offset, std::ios_base::seekdir Origin, std::ios_base::openmode Mode) override;
+        /// @copydoc std::streambuf::seekpos(pos_type,std::ios_base::openmode)
+        pos_type seekpos(pos_type Position, std::ios_base::openmode Mode) override;
+    };//WriteBehindBuffer
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An output Stream that writes a file on a background thread.
+    /// @details Flush only queues buffered data to be written and returns without waiting for the file. Use
+    /// FlushAndWait when the data needs to have reached the file.
+    ///////////////////////////////////////
+    class MEZZ_LIB WriteBehindOutputStream : public OutputStream
+    {
+    protected:
+        /// @brief The buffer writing the file.
+        std::filebuf FileBuffer;
+        /// @brief The buffer collecting writes to be written on the flusher thread.
+        WriteBehindBuffer WriteBuffer;
+        /// @brief The name of the open file.
+        String FileName;
+    public:
+        /// @brief Blank constructor.
+        /// @param Size The number of bytes in each block.
+        /// @param BlockCount The number of blocks to use. At least two will be used.
+        WriteBehindOutputStream(const StreamSize Size = WriteBehindBuffer::DefaultBlockSize,
+                                const size_t BlockCount = WriteBehindBuffer::DefaultBlockCount);
+        /// @brief File constructor.
+        /// @remarks If the file fails to open the Stream will have it's fail bit set.
+        /// @param File The name of the file to open.
+        /// @param Append Whether to add to the end of an existing file rather than replacing it.
+        /// @param Size The number of bytes in each block.
+        /// @param BlockCount The number of blocks to use. At least two will be used.
+        WriteBehindOutputStream(const String& File,
+                                const Boole Append = false,
+                                const StreamSize Size = WriteBehindBuffer::DefaultBlockSize,
+                                const size_t BlockCount = WriteBehindBuffer::DefaultBlockCount);
+        /// @brief Class destructor.
+        /// @remarks Blocks until all data written to this Stream has been written to the file.
+        virtual ~WriteBehindOutputStream() = default;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // File Operations
+
+        /// @brief Opens a file for writing.
+        /// @remarks If a file is already open it will be closed first. On failure the fail bit will be set.
+        /// @param File The name of the file to open.
+        /// @param Append Whether to add to the end of an existing file rather than replacing it.
+        void OpenFile(const String& File, const Boole Append = false);
+        /// @brief Writes all pending data and closes the current file.
+        void CloseFile();
+        /// @brief Gets whether or not a file is open.
+        /// @return Returns true if a file is currently open, false otherwise.
+        [[nodiscard]] Boole IsOpen() const;
+
+        /// @brief Waits for all data written to this Stream to be written to the file.
+        /// @return Returns true if all data was successfully written and the Stream is usable, false otherwise.
+        Boole FlushAndWait();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Stream Base Operations
+
+        /// @copydoc StreamBase::GetIdentifier() const
+        [[nodiscard]] virtual String GetIdentifier() const;
+        /// @copydoc StreamBase::GetGroup() const
+        [[nodiscard]] virtual String GetGroup() const;
+
+        /// @copydoc StreamBase::GetSize() const
+        [[nodiscard]] virtual StreamSize GetSize() const;
+        /// @copydoc StreamBase::CanSeek() const
+        [[nodiscard]] virtual Boole CanSeek() const;
+        /// @copydoc StreamBase::IsEncrypted() const
+        [[nodiscard]] virtual Boole IsEncrypted() const;
+        /// @copydoc StreamBase::IsRaw() const
+        [[nodiscard]] virtual Boole IsRaw() const;
+    };//WriteBehindOutputStream
+
+    RESTORE_WARNING_STATE
+
+    /// @brief Convenience type for a write behind output stream in a shared_ptr.
+    using WriteBehindOutputStreamPtr = std::shared_ptr<WriteBehindOutputStream>;
+}//Mezzanine
+
+#endif
@@ -0,0 +1,115 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "AsyncReadQueue.h"
+
+namespace Mezzanine
+{
+    AsyncReadQueue::AsyncReadQueue(const size_t ThreadCount)
+    {
+        const size_t ActualCount = std::max(ThreadCount,size_t(1));
+        this->Workers.reserve(ActualCount);
+        for( size_t CurrThread = 0 ; CurrThread < ActualCount ; ++CurrThread )
+        {
+            this->Workers.emplace_back([this](){ this->ServiceRequests(); });
+        }
+    }
+
+    AsyncReadQueue::~AsyncReadQueue()
+    {
+        {
+            std::lock_guard<std::mutex> Lock(this->QueueLock);
+            this->ShuttingDown = true;
+        }
+        this->QueueCondition.notify_all();
+        for( std::thread& Worker : this->Workers )
+        {
+            Worker.join();
+        }
+    }
+
+    void AsyncReadQueue::ServiceRequests()
+    {
+        while( true )
+        {
+            std::packaged_task<StreamSize()> Request;
+            {
+                std::unique_lock<std::mutex> Lock(this->QueueLock);
+                this->QueueCondition.wait(Lock,[this](){ return this->ShuttingDown || !this->Pending.empty(); });
+                if( this->Pending.empty() ) {
+                    return;
+                }
+                Request = std::move(this->Pending.front());
+                this->Pending.pop_front();
+            }
+            Request();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Requests
+
+    std::future<StreamSize> AsyncReadQueue::Submit(ReadTask Task)
+    {
+        std::packaged_task<StreamSize()> Request(std::move(Task));
+        std::future<StreamSize> Ret = Request.get_future();
+        {
+            std::lock_guard<std::mutex> Lock(this->QueueLock);
+            this->Pending.push_back(std::move(Request));
+        }
+        this->QueueCondition.notify_one();
+        return Ret;
+    }
+
+    size_t AsyncReadQueue::GetThreadCount() const noexcept
+        { return this->Workers.size(); }
+
+    size_t AsyncReadQueue::GetPendingCount()
+    {
+        std::lock_guard<std::mutex> Lock(this->QueueLock);
+        return this->Pending.size();
+    }
+
+    AsyncReadQueue& AsyncReadQueue::GetDefault()
+    {
+        static AsyncReadQueue DefaultQueue( std::max(size_t(std::thread::hardware_concurrency()),size_t(4)) );
+        return DefaultQueue;
+    }
+}//Mezzanine
@@ -39,6 +39,8 @@
 */
 
 #include "BinaryStreamReader.h"
+#include "FloatTools.h"
+#include "VarIntTools.h"
 
 namespace Mezzanine
 {
@@ -46,6 +48,26 @@ namespace Mezzanine
         Stream(Input)
         {  }
 
+    BinaryStreamReader::BinaryStreamReader(const BinaryStreamReader& Other) :
+        Stream(Other.Stream)
+        {  }
+
+    BinaryStreamReader& BinaryStreamReader::operator=(const BinaryStreamReader& Other)
+    {
+        this->Stream = Other.Stream;
+        return *this;
+    }
+
+    Boole BinaryStreamReader::ReadRecord(void* Record, const size_t Size)
+    {
+        const StreamSize Bytes = static_cast<StreamSize>(Size);
+        if( StreamTools::TryReadBuffered(*this->Stream,Record,Bytes) ) {
+            return true;
+        }
+        this->Stream->read(static_cast<char*>(Record),Bytes);
+        return ( this->Stream->gcount() == Bytes );
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     // Reading
 
@@ -53,14 +75,112 @@ namespace Mezzanine
     {
         BinaryBuffer::Byte* MaybeReturn = new BinaryBuffer::Byte[static_cast<SizeType>(Bytes)];
         this->Stream->read(reinterpret_cast<char*>(MaybeReturn),Bytes);
-        StreamSize ActuallyRead = this->Stream->gcount();
-        if( ActuallyRead < Bytes ) {
-            BinaryBuffer SmallerReturn(static_cast<SizeType>(ActuallyRead));
-            std::copy_n(MaybeReturn,ActuallyRead,SmallerReturn.Binary);
-            delete[] MaybeReturn;
-            return SmallerReturn;
+        // On a short read the allocation is simply larger than the reported Size, which is harmless.
+        return BinaryBuffer(MaybeReturn,static_cast<SizeType>( this->Stream->gcount() ));
+    }
+
+    StreamSize BinaryStreamReader::Read(void* Buffer, const StreamSize Bytes)
+    {
+        this->Stream->read(static_cast<char*>(Buffer),Bytes);
+        return this->Stream->gcount();
+    }
+
+    StreamSize BinaryStreamReader::Read(BinaryBuffer& Buffer)
+        { return this->Read(Buffer.Binary,static_cast<StreamSize>(Buffer.Size)); }
+
+    StringView BinaryStreamReader::ReadView(const StreamSize Bytes)
+    {
+        const size_t Needed = static_cast<size_t>(Bytes);
+        if( Needed > this->ScratchCapacity ) {
+            const size_t NewSize = std::max(Needed,this->ScratchCapacity * 2);
+            this->Scratch = BufferPool::Acquire(NewSize);
+            this->ScratchCapacity = BufferPool::GetCapacity(NewSize);
+        }
+        const StreamSize ActuallyRead = this->Read(this->Scratch.get(),Bytes);
+        return StringView(this->Scratch.get(),static_cast<size_t>(ActuallyRead));
+    }
+
+    size_t BinaryStreamReader::ReadFloats(float* Values, const size_t Count, const FloatEncoding Encoding, const ByteOrder Order)
+    {
+        if( Encoding == FloatEncoding::Float32 ) {
+            return this->ReadArray(Values,Count,Order);
+        }
+        const size_t EncodedSize = FloatTools::GetEncodedSize(Encoding);
+        constexpr size_t StagingCount = 2048;
+        UInt16 Staging[StagingCount];
+        size_t Done = 0;
+        while( Done < Count )
+        {
+            const size_t Batch = std::min(StagingCount,Count - Done);
+            this->Stream->read(reinterpret_cast<char*>(Staging),static_cast<StreamSize>( Batch * EncodedSize ));
+            const size_t Decoded = static_cast<size_t>( this->Stream->gcount() ) / EncodedSize;
+            if( EncodedSize > 1 ) {
+                EndianTools::ConvertArray(Staging,Decoded,Order);
+            }
+            FloatTools::DecodeFloats(Staging,Decoded,Encoding,Values + Done);
+            Done += Decoded;
+            if( Decoded < Batch ) {
+                break;
+            }
+        }
+        return Done;
+    }
+
+    UInt64 BinaryStreamReader::ReadVarInt()
+    {
+        std::istream& Input = *this->Stream;
+        UInt64 Value = 0;
+        std::streambuf* Buf = Input.rdbuf();
+        if( Input.good() && Input.tie() == nullptr &&
+            StreamTools::GetAvailable(Buf) >= static_cast<StreamSize>(VarIntTools::MaxVarIntSize) )
+        {
+            // The whole varint is known to be buffered, so decode it in place.
+            const UInt8* Current = reinterpret_cast<const UInt8*>( StreamBufferAccess::GetCurrent(Buf) );
+            const size_t Consumed = VarIntTools::DecodeVarInt(Current,VarIntTools::MaxVarIntSize,Value);
+            if( Consumed == 0 ) {
+                Input.setstate(std::ios_base::failbit);
+                return 0;
+            }
+            StreamBufferAccess::GetAdvance(Buf,static_cast<StreamSize>(Consumed));
+            return Value;
+        }
+
+        UInt8 Encoded[VarIntTools::MaxVarIntSize];
+        for( size_t Index = 0 ; Index < VarIntTools::MaxVarIntSize ; ++Index )
+        {
+            const std::istream::int_type Next = Input.get();
+            if( std::istream::traits_type::eq_int_type(Next,std::istream::traits_type::eof()) ) {
+                return 0;
+            }
+            Encoded[Index] = static_cast<UInt8>(Next);
+            if( ( Encoded[Index] & 0x80 ) == 0 ) {
+                if( VarIntTools::DecodeVarInt(Encoded,Index + 1,Value) == 0 ) {
+                    break;
+                }
+                return Value;
+            }
+        }
+        Input.setstate(std::ios_base::failbit);
+        return 0;
+    }
+
+    Int64 BinaryStreamReader::ReadZigZag()
+        { return VarIntTools::ZigZagDecode( this->ReadVarInt() ); }
+
+    size_t BinaryStreamReader::ReadStreamVByte(UInt32* Values, const size_t Count)
+    {
+        const size_t ControlSize = VarIntTools::StreamVByteControlSize(Count);
+        BufferPool::BufferPtr Encoded = BufferPool::Acquire( VarIntTools::StreamVByteMaxSize(Count) );
+        UInt8* EncodedBytes = reinterpret_cast<UInt8*>( Encoded.get() );
+        if( this->Read(EncodedBytes,static_cast<StreamSize>(ControlSize)) < static_cast<StreamSize>(ControlSize) ) {
+            return 0;
+        }
+        const StreamSize DataSize = static_cast<StreamSize>( VarIntTools::StreamVByteDataSize(EncodedBytes,Count) );
+        if( this->Read(EncodedBytes + ControlSize,DataSize) < DataSize ) {
+            return 0;
         }
-        return BinaryBuffer(MaybeReturn,static_cast<SizeType>(ActuallyRead));
+        VarIntTools::StreamVByteDecode(EncodedBytes,Count,Values);
+        return Count;
     }
 
     StreamSize BinaryStreamReader::Skip(const StreamSize Bytes)
@@ -39,6 +39,9 @@
 */
 
 #include "BinaryStreamWriter.h"
+#include "BufferPool.h"
+#include "FloatTools.h"
+#include "VarIntTools.h"
 #include "MezzException.h"
 
 namespace Mezzanine
@@ -47,6 +50,16 @@ namespace Mezzanine
         Stream(Output)
         {  }
 
+    Boole BinaryStreamWriter::WriteRecord(const void* Record, const size_t Size)
+    {
+        const StreamSize Bytes = static_cast<StreamSize>(Size);
+        if( StreamTools::TryWriteBuffered(*this->Stream,Record,Bytes) ) {
+            return true;
+        }
+        this->Stream->write(static_cast<const char*>(Record),Bytes);
+        return this->Stream->good();
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     // Writing
 
@@ -59,4 +72,49 @@ namespace Mezzanine
         this->Stream->write(reinterpret_cast<char*>(ToWrite.Binary),static_cast<StreamSize>(ToWrite.Size));
         return this->Stream->good();
     }
+
+    Boole BinaryStreamWriter::WriteFloats(const float* Values, const size_t Count, const FloatEncoding Encoding, const ByteOrder Order)
+    {
+        if( Encoding == FloatEncoding::Float32 ) {
+            return this->WriteArray(Values,Count,Order);
+        }
+        const size_t EncodedSize = FloatTools::GetEncodedSize(Encoding);
+        constexpr size_t StagingCount = 2048;
+        UInt16 Staging[StagingCount];
+        for( size_t Done = 0 ; Done < Count && this->Stream->good() ; Done += StagingCount )
+        {
+            const size_t Batch = std::min(StagingCount,Count - Done);
+            FloatTools::EncodeFloats(Values + Done,Batch,Encoding,Staging);
+            if( EncodedSize > 1 ) {
+                EndianTools::ConvertArray(Staging,Batch,Order);
+            }
+            this->Stream->write(reinterpret_cast<const char*>(Staging),static_cast<StreamSize>( Batch * EncodedSize ));
+        }
+        return this->Stream->good();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Variable Length Writing
+
+    Boole BinaryStreamWriter::WriteVarInt(const UInt64 ToWrite)
+    {
+        UInt8 Encoded[VarIntTools::MaxVarIntSize];
+        const StreamSize Size = static_cast<StreamSize>( VarIntTools::EncodeVarInt(ToWrite,Encoded) );
+        if( StreamTools::TryWriteBuffered(*this->Stream,Encoded,Size) ) {
+            return true;
+        }
+        this->Stream->write(reinterpret_cast<char*>(Encoded),Size);
+        return this->Stream->good();
+    }
+
+    Boole BinaryStreamWriter::WriteZigZag(const Int64 ToWrite)
+        { return this->WriteVarInt( VarIntTools::ZigZagEncode(ToWrite) ); }
+
+    Boole BinaryStreamWriter::WriteStreamVByte(const UInt32* Values, const size_t Count)
+    {
+        BufferPool::BufferPtr Encoded = BufferPool::Acquire( VarIntTools::StreamVByteMaxSize(Count) );
+        const size_t Size = VarIntTools::StreamVByteEncode(Values,Count,reinterpret_cast<UInt8*>(Encoded.get()));
+        this->Stream->write(Encoded.get(),static_cast<StreamSize>(Size));
+        return this->Stream->good();
+    }
 }//Mezzanine
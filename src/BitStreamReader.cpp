@@ -0,0 +1,190 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "BitStreamReader.h"
+#include "EndianTools.h"
+#include "StreamTools.h"
+
+#include <cstring>
+
+namespace
+{
+    /// @brief Gets a mask of the low bits of a 64-bit value.
+    /// @param Count The number of bits to keep.
+    /// @return Returns a value with the low Count bits set.
+    constexpr Mezzanine::UInt64 LowBitMask(const Mezzanine::UInt32 Count) noexcept
+        { return ( Count >= 64 ? ~Mezzanine::UInt64(0) : ( Mezzanine::UInt64(1) << Count ) - 1 ); }
+}
+
+namespace Mezzanine
+{
+    BitStreamReader::BitStreamReader(StdInputStreamPtr Input) :
+        Stream(Input)
+        {  }
+
+    void BitStreamReader::Refill()
+    {
+        std::istream& Input = *this->Stream;
+        if( !Input.good() ) {
+            return;
+        }
+        std::streambuf* Buf = Input.rdbuf();
+        if( Input.tie() == nullptr && StreamTools::GetAvailable(Buf) >= StreamSize(8) ) {
+            // Load a whole word, keep as many whole bytes of it as fit and only advance past those.
+            UInt64 Word = 0;
+            std::memcpy(&Word,StreamBufferAccess::GetCurrent(Buf),sizeof(UInt64));
+            Word = EndianTools::ConvertByteOrder(Word,ByteOrder::Little);
+            const UInt32 Bytes = ( 63 - this->BitCount ) / 8;
+            this->Accumulator |= Word << this->BitCount;
+            this->BitCount += Bytes * 8;
+            this->Accumulator &= LowBitMask(this->BitCount);
+            StreamBufferAccess::GetAdvance(Buf,static_cast<StreamSize>(Bytes));
+            return;
+        }
+
+        if( Input.tie() != nullptr ) {
+            Input.tie()->flush();
+        }
+        while( this->BitCount <= 56 )
+        {
+            // Reaching the end while topping up isn't a failure, as long as the bits asked for are there.
+            const std::streambuf::int_type Next = Buf->sbumpc();
+            if( std::streambuf::traits_type::eq_int_type(Next,std::streambuf::traits_type::eof()) ) {
+                Input.setstate(std::ios_base::eofbit);
+                return;
+            }
+            this->Accumulator |= UInt64( static_cast<UInt8>(Next) ) << this->BitCount;
+            this->BitCount += 8;
+        }
+    }
+
+    Boole BitStreamReader::TakeBits(const UInt32 Count, UInt64& Value)
+    {
+        if( this->BitCount < Count ) {
+            this->Refill();
+            if( this->BitCount < Count ) {
+                return false;
+            }
+        }
+        Value = this->Accumulator & LowBitMask(Count);
+        this->Accumulator = ( Count >= 64 ? 0 : this->Accumulator >> Count );
+        this->BitCount -= Count;
+        this->TotalBits += Count;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Reading
+
+    UInt64 BitStreamReader::ReadBits(const UInt32 Count)
+    {
+        UInt64 Value = 0;
+        if( Count <= MaxPeekBits ) {
+            if( !this->TakeBits(Count,Value) ) {
+                this->Stream->setstate(std::ios_base::failbit);
+                return 0;
+            }
+            return Value;
+        }
+        // Too wide to be sure of fitting in the accumulator after a refill, so read in two halves.
+        UInt64 High = 0;
+        if( !this->TakeBits(32,Value) || !this->TakeBits(Count - 32,High) ) {
+            this->Stream->setstate(std::ios_base::failbit);
+            return 0;
+        }
+        return Value | ( High << 32 );
+    }
+
+    Boole BitStreamReader::ReadBit()
+        { return this->ReadBits(1) != 0; }
+
+    UInt64 BitStreamReader::PeekBits(const UInt32 Count)
+    {
+        if( this->BitCount < Count ) {
+            this->Refill();
+        }
+        return this->Accumulator & LowBitMask(Count);
+    }
+
+    UInt64 BitStreamReader::SkipBits(const UInt64 Count)
+    {
+        UInt64 Skipped = 0;
+        while( Skipped < Count )
+        {
+            if( this->BitCount == 0 ) {
+                this->Refill();
+                if( this->BitCount == 0 ) {
+                    break;
+                }
+            }
+            const UInt32 Step = static_cast<UInt32>( std::min(UInt64(this->BitCount),Count - Skipped) );
+            this->Accumulator = ( Step >= 64 ? 0 : this->Accumulator >> Step );
+            this->BitCount -= Step;
+            Skipped += Step;
+        }
+        this->TotalBits += Skipped;
+        return Skipped;
+    }
+
+    void BitStreamReader::AlignToByte()
+    {
+        const UInt32 Partial = static_cast<UInt32>( this->TotalBits % 8 );
+        if( Partial != 0 ) {
+            this->SkipBits(8 - Partial);
+        }
+    }
+
+    Boole BitStreamReader::SyncStreamPosition()
+    {
+        this->AlignToByte();
+        const StreamOff Unread = static_cast<StreamOff>(this->BitCount / 8);
+        this->Accumulator = 0;
+        this->BitCount = 0;
+        if( Unread == 0 ) {
+            return true;
+        }
+        this->Stream->clear(this->Stream->rdstate() & ~std::ios_base::eofbit);
+        this->Stream->seekg(-Unread,std::ios_base::cur);
+        return !this->Stream->fail();
+    }
+
+    UInt64 BitStreamReader::GetBitsRead() const
+        { return this->TotalBits; }
+}//Mezzanine
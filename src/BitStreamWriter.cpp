@@ -0,0 +1,100 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "BitStreamWriter.h"
+#include "EndianTools.h"
+#include "StreamTools.h"
+
+namespace Mezzanine
+{
+    BitStreamWriter::BitStreamWriter(StdOutputStreamPtr Output) :
+        Stream(Output)
+        {  }
+
+    BitStreamWriter::~BitStreamWriter()
+        { this->AlignToByte(); }
+
+    void BitStreamWriter::WriteWord(const UInt64 Word)
+    {
+        const UInt64 LittleWord = EndianTools::ConvertByteOrder(Word,ByteOrder::Little);
+        if( !StreamTools::TryWriteBuffered(*this->Stream,&LittleWord,sizeof(UInt64)) ) {
+            this->Stream->write(reinterpret_cast<const char*>(&LittleWord),sizeof(UInt64));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Writing
+
+    Boole BitStreamWriter::WriteBits(const UInt64 ToWrite, const UInt32 Count)
+    {
+        const UInt64 Value = ( Count >= 64 ? ToWrite : ToWrite & ( ( UInt64(1) << Count ) - 1 ) );
+        const UInt32 Total = this->BitCount + Count;
+        this->Accumulator |= Value << this->BitCount;
+        this->TotalBits += Count;
+        if( Total >= 64 ) {
+            this->WriteWord(this->Accumulator);
+            // Whatever didn't fit above the bits already in the accumulator starts the next word.
+            this->Accumulator = ( this->BitCount == 0 ? 0 : Value >> ( 64 - this->BitCount ) );
+            this->BitCount = Total - 64;
+        }else{
+            this->BitCount = Total;
+        }
+        return this->Stream->good();
+    }
+
+    Boole BitStreamWriter::WriteBit(const Boole ToWrite)
+        { return this->WriteBits(ToWrite ? 1 : 0,1); }
+
+    Boole BitStreamWriter::AlignToByte()
+    {
+        const UInt32 Bytes = ( this->BitCount + 7 ) / 8;
+        if( Bytes > 0 ) {
+            const UInt64 LittleWord = EndianTools::ConvertByteOrder(this->Accumulator,ByteOrder::Little);
+            this->Stream->write(reinterpret_cast<const char*>(&LittleWord),static_cast<StreamSize>(Bytes));
+            this->TotalBits += Bytes * 8 - this->BitCount;
+            this->Accumulator = 0;
+            this->BitCount = 0;
+        }
+        return this->Stream->good();
+    }
+
+    UInt64 BitStreamWriter::GetBitsWritten() const
+        { return this->TotalBits; }
+}//Mezzanine
@@ -0,0 +1,289 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "BufferPool.h"
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief The number of size classes small enough to be cached per thread.
+    constexpr size_t ThreadClassCount = 9;
+    /// @brief The most buffers of a single size class kept in the shared cache.
+    constexpr size_t MaxSharedDepth = 64;
+
+    static_assert( ( BufferPool::MinPooledSize << ( BufferPool::ClassCount - 1 ) ) == BufferPool::MaxPooledSize,
+                   "ClassCount does not match the pooled size range." );
+    static_assert( ( BufferPool::MinPooledSize << ( ThreadClassCount - 1 ) ) == BufferPool::MaxThreadCachedSize,
+                   "ThreadClassCount does not match the thread cached size range." );
+
+    /// @brief Gets the size class of a request.
+    /// @param Size The requested size. Must not be larger than MaxPooledSize.
+    /// @return Returns the index of the smallest size class that can hold Size bytes.
+    size_t GetClassIndex(const size_t Size) noexcept
+    {
+        size_t Index = 0;
+        while( ( BufferPool::MinPooledSize << Index ) < Size )
+            { ++Index; }
+        return Index;
+    }
+
+    /// @brief Gets the number of buffers of a size class to keep in the shared cache.
+    /// @param Index The index of the size class.
+    /// @return Returns the depth of the shared cache for the size class.
+    size_t GetSharedDepth(const size_t Index) noexcept
+    {
+        const size_t Depth = BufferPool::SharedCacheBytes / ( BufferPool::MinPooledSize << Index );
+        return std::min( std::max(Depth,size_t(1)), MaxSharedDepth );
+    }
+
+    /// @brief Whether or not the shared cache can still be used. Cleared during static destruction.
+    Boole SharedCacheAlive = false;
+
+    /// @brief The buffers available to every thread.
+    struct SharedCache
+    {
+        /// @brief Mutex protecting the lists.
+        std::mutex CacheLock;
+        /// @brief The free buffers of each size class.
+        std::array<std::vector<Char8*>,BufferPool::ClassCount> Lists;
+
+        /// @brief Class constructor.
+        SharedCache()
+            { SharedCacheAlive = true; }
+        /// @brief Class destructor.
+        ~SharedCache()
+        {
+            SharedCacheAlive = false;
+            this->Trim();
+        }
+
+        /// @brief Frees every buffer in the cache.
+        void Trim()
+        {
+            std::lock_guard<std::mutex> Lock(this->CacheLock);
+            for( std::vector<Char8*>& List : this->Lists )
+            {
+                for( Char8* Buffer : List )
+                    { ::operator delete(Buffer); }
+                List.clear();
+            }
+        }
+    };//SharedCache
+
+    /// @brief Gets the shared cache.
+    /// @return Returns a reference to the shared cache.
+    SharedCache& GetSharedCache()
+    {
+        static SharedCache Cache;
+        return Cache;
+    }
+
+    /// @brief Takes a buffer from the shared cache or allocates a new one.
+    /// @param Index The index of the size class to get.
+    /// @return Returns a buffer of the requested size class.
+    Char8* AllocateShared(const size_t Index)
+    {
+        SharedCache& Shared = GetSharedCache();
+        {
+            std::lock_guard<std::mutex> Lock(Shared.CacheLock);
+            std::vector<Char8*>& List = Shared.Lists[Index];
+            if( !List.empty() ) {
+                Char8* Ret = List.back();
+                List.pop_back();
+                return Ret;
+            }
+        }
+        return static_cast<Char8*>( ::operator new(BufferPool::MinPooledSize << Index) );
+    }
+
+    /// @brief Puts a buffer in the shared cache or frees it.
+    /// @param Buffer The buffer to release.
+    /// @param Index The index of the size class of the buffer.
+    void DeallocateShared(Char8* Buffer, const size_t Index) noexcept
+    {
+        if( SharedCacheAlive ) {
+            SharedCache& Shared = GetSharedCache();
+            std::lock_guard<std::mutex> Lock(Shared.CacheLock);
+            std::vector<Char8*>& List = Shared.Lists[Index];
+            if( List.size() < GetSharedDepth(Index) ) {
+                try {
+                    List.push_back(Buffer);
+                    return;
+                }catch(...){
+                    // Fall through and free it.
+                }
+            }
+        }
+        ::operator delete(Buffer);
+    }
+
+    /// @brief The lifetime stages of the cache of a thread.
+    enum class ThreadCacheState : UInt8
+    {
+        Unborn,    ///< The cache hasn't been used on this thread yet and will be created on first use.
+        Alive,     ///< The cache exists and can be used.
+        Destroyed  ///< The thread is exiting and the cache is gone, only the shared cache can be used.
+    };
+
+    /// @brief The lifetime stage of the cache of the calling thread.
+    thread_local ThreadCacheState ThreadCacheStage = ThreadCacheState::Unborn;
+
+    /// @brief The buffers available to only one thread.
+    struct ThreadCache
+    {
+        /// @brief The free buffers of each size class.
+        std::array<std::array<Char8*,BufferPool::ThreadCacheDepth>,ThreadClassCount> Buffers{};
+        /// @brief The number of free buffers of each size class.
+        std::array<size_t,ThreadClassCount> Counts{};
+
+        /// @brief Class constructor.
+        ThreadCache()
+        {
+            // Make sure the shared cache outlives this.
+            GetSharedCache();
+            ThreadCacheStage = ThreadCacheState::Alive;
+        }
+        /// @brief Class destructor.
+        ~ThreadCache()
+        {
+            ThreadCacheStage = ThreadCacheState::Destroyed;
+            this->Trim();
+        }
+
+        /// @brief Moves every buffer in this cache to the shared cache.
+        void Trim() noexcept
+        {
+            for( size_t Index = 0 ; Index < ThreadClassCount ; ++Index )
+            {
+                while( this->Counts[Index] > 0 )
+                    { DeallocateShared(this->Buffers[Index][--this->Counts[Index]],Index); }
+            }
+        }
+    };//ThreadCache
+
+    /// @brief Gets the cache of the calling thread.
+    /// @return Returns a reference to the calling thread's cache.
+    ThreadCache& GetThreadCache()
+    {
+        thread_local ThreadCache Cache;
+        return Cache;
+    }
+}
+
+namespace Mezzanine
+{
+    size_t BufferPool::GetCapacity(const size_t Size) noexcept
+    {
+        if( Size > MaxPooledSize ) {
+            return Size;
+        }
+        return MinPooledSize << GetClassIndex(Size);
+    }
+
+    Char8* BufferPool::Allocate(const size_t Size)
+    {
+        if( Size > MaxPooledSize ) {
+            return static_cast<Char8*>( ::operator new(Size) );
+        }
+        const size_t Index = GetClassIndex(Size);
+        // Thread locals destroyed after the cache can still allocate, they have to use the shared cache.
+        if( Index < ThreadClassCount && ThreadCacheStage != ThreadCacheState::Destroyed ) {
+            ThreadCache& Local = GetThreadCache();
+            if( Local.Counts[Index] > 0 ) {
+                return Local.Buffers[Index][--Local.Counts[Index]];
+            }
+        }
+        return AllocateShared(Index);
+    }
+
+    void BufferPool::Deallocate(Char8* Buffer, const size_t Size) noexcept
+    {
+        if( Buffer == nullptr ) {
+            return;
+        }
+        if( Size > MaxPooledSize ) {
+            ::operator delete(Buffer);
+            return;
+        }
+        const size_t Index = GetClassIndex(Size);
+        if( Index < ThreadClassCount && ThreadCacheStage != ThreadCacheState::Destroyed ) {
+            ThreadCache& Local = GetThreadCache();
+            if( Local.Counts[Index] < ThreadCacheDepth ) {
+                Local.Buffers[Index][Local.Counts[Index]++] = Buffer;
+                return;
+            }
+        }
+        DeallocateShared(Buffer,Index);
+    }
+
+    BufferPool::BufferPtr BufferPool::Acquire(const size_t Size)
+        { return BufferPtr(Allocate(Size),Deleter{Size}); }
+
+    size_t BufferPool::GetThreadCachedCount(const size_t Size) noexcept
+    {
+        if( Size > MaxThreadCachedSize || ThreadCacheStage != ThreadCacheState::Alive ) {
+            return 0;
+        }
+        return GetThreadCache().Counts[ GetClassIndex(Size) ];
+    }
+
+    size_t BufferPool::GetSharedCachedCount(const size_t Size)
+    {
+        if( Size > MaxPooledSize ) {
+            return 0;
+        }
+        SharedCache& Shared = GetSharedCache();
+        std::lock_guard<std::mutex> Lock(Shared.CacheLock);
+        return Shared.Lists[ GetClassIndex(Size) ].size();
+    }
+
+    void BufferPool::Trim()
+    {
+        if( ThreadCacheStage == ThreadCacheState::Alive ) {
+            GetThreadCache().Trim();
+        }
+        GetSharedCache().Trim();
+    }
+}//Mezzanine
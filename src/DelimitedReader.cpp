@@ -0,0 +1,363 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#include "DelimitedReader.h"
+#include "StreamTools.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief The number of characters classified at a time.
+    constexpr size_t BlockSize = 64;
+
+    /// @brief The positions in a block matching each of two characters, one bit per character.
+    struct BlockMasks
+    {
+        /// @brief The positions matching the first character.
+        UInt64 First = 0;
+        /// @brief The positions matching the second character.
+        UInt64 Second = 0;
+    };//BlockMasks
+
+    /// @brief Gets the index of the lowest set bit.
+    /// @param Value The value to check. Must not be 0.
+    /// @return Returns the number of zero bits below the lowest set bit.
+    size_t CountTrailingZeros(const UInt64 Value) noexcept
+    {
+    #if defined(_MSC_VER)
+        unsigned long Index = 0;
+        _BitScanForward64(&Index,Value);
+        return Index;
+    #else
+        return static_cast<size_t>( __builtin_ctzll(Value) );
+    #endif
+    }
+
+    /// @brief Sets every bit that has an odd number of set bits at or below it.
+    /// @remarks Applied to the positions of quotes this yields the positions that are inside quotes, counting the
+    /// opening quote but not the closing one.
+    /// @param Value The bits to scan.
+    /// @return Returns the running xor of the bits of Value, from lowest to highest.
+    UInt64 PrefixXor(UInt64 Value) noexcept
+    {
+    #if defined(__PCLMUL__) && defined(__x86_64__)
+        // A carryless multiply by all ones is exactly a running xor.
+        const __m128i Product = _mm_clmulepi64_si128(_mm_set_epi64x(0,static_cast<long long>(Value)),
+                                                     _mm_set1_epi8(static_cast<char>(0xFF)),0);
+        return static_cast<UInt64>( _mm_cvtsi128_si64(Product) );
+    #else
+        Value ^= Value << 1;
+        Value ^= Value << 2;
+        Value ^= Value << 4;
+        Value ^= Value << 8;
+        Value ^= Value << 16;
+        Value ^= Value << 32;
+        return Value;
+    #endif
+    }
+
+    /// @brief Finds the positions of two characters in a full block.
+    /// @param Block The start of the characters to classify. Must have BlockSize readable characters.
+    /// @param First The first character to find.
+    /// @param Second The second character to find.
+    /// @return Returns the positions in the block matching each character.
+    BlockMasks ClassifyFullBlock(const Char8* Block, const Char8 First, const Char8 Second) noexcept
+    {
+        BlockMasks Masks;
+    #if defined(__AVX2__)
+        const __m256i FirstNeedle = _mm256_set1_epi8(First);
+        const __m256i SecondNeedle = _mm256_set1_epi8(Second);
+        for( size_t Offset = 0 ; Offset < BlockSize ; Offset += 32 )
+        {
+            const __m256i Chunk = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( Block + Offset ) );
+            const UInt32 FirstBits = static_cast<UInt32>( _mm256_movemask_epi8( _mm256_cmpeq_epi8(Chunk,FirstNeedle) ) );
+            const UInt32 SecondBits = static_cast<UInt32>( _mm256_movemask_epi8( _mm256_cmpeq_epi8(Chunk,SecondNeedle) ) );
+            Masks.First |= static_cast<UInt64>(FirstBits) << Offset;
+            Masks.Second |= static_cast<UInt64>(SecondBits) << Offset;
+        }
+    #elif defined(__SSE2__) || defined(_M_X64)
+        const __m128i FirstNeedle = _mm_set1_epi8(First);
+        const __m128i SecondNeedle = _mm_set1_epi8(Second);
+        for( size_t Offset = 0 ; Offset < BlockSize ; Offset += 16 )
+        {
+            const __m128i Chunk = _mm_loadu_si128( reinterpret_cast<const __m128i*>( Block + Offset ) );
+            const UInt32 FirstBits = static_cast<UInt32>( _mm_movemask_epi8( _mm_cmpeq_epi8(Chunk,FirstNeedle) ) );
+            const UInt32 SecondBits = static_cast<UInt32>( _mm_movemask_epi8( _mm_cmpeq_epi8(Chunk,SecondNeedle) ) );
+            Masks.First |= static_cast<UInt64>(FirstBits) << Offset;
+            Masks.Second |= static_cast<UInt64>(SecondBits) << Offset;
+        }
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        // NEON has no movemask, so weight each lane by its bit and add neighbouring lanes together.
+        const uint8x16_t Weights = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        const uint8_t* Data = reinterpret_cast<const uint8_t*>(Block);
+        const uint8x16_t Chunks[4] = { vld1q_u8(Data), vld1q_u8(Data + 16), vld1q_u8(Data + 32), vld1q_u8(Data + 48) };
+        auto Gather = [&](const Char8 Target) -> UInt64 {
+            const uint8x16_t Needle = vdupq_n_u8( static_cast<uint8_t>(Target) );
+            uint8x16_t Sum0 = vpaddq_u8( vandq_u8(vceqq_u8(Chunks[0],Needle),Weights),
+                                         vandq_u8(vceqq_u8(Chunks[1],Needle),Weights) );
+            uint8x16_t Sum1 = vpaddq_u8( vandq_u8(vceqq_u8(Chunks[2],Needle),Weights),
+                                         vandq_u8(vceqq_u8(Chunks[3],Needle),Weights) );
+            Sum0 = vpaddq_u8(Sum0,Sum1);
+            Sum0 = vpaddq_u8(Sum0,Sum0);
+            return vgetq_lane_u64(vreinterpretq_u64_u8(Sum0),0);
+        };
+        Masks.First = Gather(First);
+        Masks.Second = Gather(Second);
+    #else
+        for( size_t Index = 0 ; Index < BlockSize ; ++Index )
+        {
+            Masks.First |= static_cast<UInt64>( Block[Index] == First ) << Index;
+            Masks.Second |= static_cast<UInt64>( Block[Index] == Second ) << Index;
+        }
+    #endif
+        return Masks;
+    }
+
+    /// @brief Finds the positions of two characters in a block that may be short.
+    /// @param Block The start of the characters to classify.
+    /// @param Count The number of characters to classify. Must be between 1 and BlockSize.
+    /// @param First The first character to find.
+    /// @param Second The second character to find.
+    /// @return Returns the positions in the block matching each character. Bits past Count are never set.
+    BlockMasks ClassifyBlock(const Char8* Block, const size_t Count, const Char8 First, const Char8 Second) noexcept
+    {
+        if( Count < BlockSize ) {
+            // Copy the tail so the vector loads never read past the end of the data.
+            alignas(BlockSize) Char8 Padded[BlockSize] = {};
+            std::memcpy(Padded,Block,Count);
+            BlockMasks Masks = ClassifyFullBlock(Padded,First,Second);
+            const UInt64 Valid = ( UInt64(1) << Count ) - 1;
+            Masks.First &= Valid;
+            Masks.Second &= Valid;
+            return Masks;
+        }
+        return ClassifyFullBlock(Block,First,Second);
+    }
+
+    /// @brief Finds the first newline that is not inside quotes.
+    /// @param Begin The start of the characters to search.
+    /// @param Length The number of characters to search.
+    /// @param Quote The character that quotes fields.
+    /// @param QuoteCarry All bits set if the search starts inside quotes, 0 otherwise. Updated to the state at
+    /// the end of the characters searched if no newline is found.
+    /// @return Returns the offset of the newline ending the record, or Length if the record continues past it.
+    size_t FindRecordEnd(const Char8* Begin, const size_t Length, const Char8 Quote, UInt64& QuoteCarry) noexcept
+    {
+        for( size_t Offset = 0 ; Offset < Length ; Offset += BlockSize )
+        {
+            const BlockMasks Masks = ClassifyBlock(Begin + Offset,std::min(BlockSize,Length - Offset),Quote,'\n');
+            const UInt64 Quoted = PrefixXor(Masks.First) ^ QuoteCarry;
+            const UInt64 Ends = Masks.Second & ~Quoted;
+            if( Ends != 0 ) {
+                return Offset + CountTrailingZeros(Ends);
+            }
+            // Bits past a short block repeat the state of its last character, so the top bit is always accurate.
+            QuoteCarry = UInt64(0) - ( Quoted >> 63 );
+        }
+        return Length;
+    }
+
+    /// @brief Removes the quoting from a field.
+    /// @param Field The field as it appears in the record.
+    /// @param Quote The character that quotes fields.
+    /// @param Scratch The buffer to unescape into if the field has doubled quotes. Must have the capacity to
+    /// grow by the size of the field without reallocating.
+    /// @return Returns the content of the field.
+    StringView UnquoteField(const StringView Field, const Char8 Quote, String& Scratch)
+    {
+        if( Field.empty() || Field.front() != Quote ) {
+            return Field;
+        }
+        if( Field.size() >= 2 && Field.back() == Quote ) {
+            const StringView Inner = Field.substr(1,Field.size() - 2);
+            if( Inner.find(Quote) == StringView::npos ) {
+                return Inner;
+            }
+        }
+
+        const size_t Start = Scratch.size();
+        Boole Quoted = false;
+        for( size_t Index = 0 ; Index < Field.size() ; ++Index )
+        {
+            const Char8 Current = Field[Index];
+            if( Current != Quote ) {
+                Scratch.push_back(Current);
+            }else if( Quoted && Index + 1 < Field.size() && Field[Index + 1] == Quote ) {
+                Scratch.push_back(Quote);
+                ++Index;
+            }else{
+                Quoted = !Quoted;
+            }
+        }
+        return StringView(Scratch.data() + Start,Scratch.size() - Start);
+    }
+}
+
+namespace Mezzanine
+{
+    DelimitedReader::DelimitedReader(StdInputStreamPtr Input, const Char8 Delimiter, const Char8 QuoteChar) :
+        Stream(Input),
+        Delim(Delimiter),
+        Quote(QuoteChar)
+        {  }
+
+    Boole DelimitedReader::FindRecord(StringView& Record)
+    {
+        using TraitsType = std::istream::traits_type;
+        std::istream& Input = *this->Stream;
+        if( Input.tie() != nullptr ) {
+            Input.tie()->flush();
+        }
+
+        std::streambuf* Buf = Input.rdbuf();
+        UInt64 QuoteCarry = 0;
+        Boole Collecting = false;
+        this->RecordScratch.clear();
+        while( true )
+        {
+            StreamSize Available = StreamTools::GetAvailable(Buf);
+            if( Available <= 0 ) {
+                if( TraitsType::eq_int_type(Buf->sgetc(),TraitsType::eof()) ) {
+                    Input.setstate(std::ios_base::eofbit);
+                    Record = this->RecordScratch;
+                    return Collecting;
+                }
+                Available = StreamTools::GetAvailable(Buf);
+            }
+            if( Available <= 0 ) {
+                // Unbuffered streambufs only hand over a character at a time.
+                const Char8 Next = TraitsType::to_char_type( Buf->sbumpc() );
+                Collecting = true;
+                if( Next == '\n' && QuoteCarry == 0 ) {
+                    Record = this->RecordScratch;
+                    return true;
+                }
+                if( Next == this->Quote ) {
+                    QuoteCarry = ~QuoteCarry;
+                }
+                this->RecordScratch.push_back(Next);
+                continue;
+            }
+
+            const Char8* Current = StreamBufferAccess::GetCurrent(Buf);
+            const size_t Length = static_cast<size_t>(Available);
+            const size_t Found = FindRecordEnd(Current,Length,this->Quote,QuoteCarry);
+            if( Found < Length ) {
+                if( Collecting ) {
+                    this->RecordScratch.append(Current,Found);
+                    Record = this->RecordScratch;
+                }else{
+                    // The common case, the whole record is buffered and can be split in place.
+                    Record = StringView(Current,Found);
+                }
+                StreamBufferAccess::GetAdvance(Buf,static_cast<StreamSize>(Found + 1));
+                return true;
+            }
+            this->RecordScratch.append(Current,Length);
+            Collecting = true;
+            StreamBufferAccess::GetAdvance(Buf,Available);
+        }
+    }
+
+    void DelimitedReader::SplitRecord(const StringView Record, std::vector<StringView>& Fields)
+    {
+        this->FieldScratch.clear();
+        this->FieldScratch.reserve(Record.size());
+
+        UInt64 QuoteCarry = 0;
+        size_t FieldStart = 0;
+        for( size_t Offset = 0 ; Offset < Record.size() ; Offset += BlockSize )
+        {
+            const size_t Count = std::min(BlockSize,Record.size() - Offset);
+            const BlockMasks Masks = ClassifyBlock(Record.data() + Offset,Count,this->Delim,this->Quote);
+            const UInt64 Quoted = PrefixXor(Masks.Second) ^ QuoteCarry;
+            for( UInt64 Bounds = Masks.First & ~Quoted ; Bounds != 0 ; Bounds &= Bounds - 1 )
+            {
+                const size_t FieldEnd = Offset + CountTrailingZeros(Bounds);
+                Fields.push_back( UnquoteField(Record.substr(FieldStart,FieldEnd - FieldStart),this->Quote,this->FieldScratch) );
+                FieldStart = FieldEnd + 1;
+            }
+            QuoteCarry = UInt64(0) - ( Quoted >> 63 );
+        }
+        Fields.push_back( UnquoteField(Record.substr(FieldStart),this->Quote,this->FieldScratch) );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Reading
+
+    Boole DelimitedReader::ReadRecord(std::vector<StringView>& Fields)
+    {
+        Fields.clear();
+        std::istream& Input = *this->Stream;
+        if( !Input.good() ) {
+            Input.setstate(std::ios_base::failbit);
+            return false;
+        }
+
+        StringView Record;
+        if( !this->FindRecord(Record) ) {
+            Input.setstate(std::ios_base::failbit);
+            return false;
+        }
+        if( !Record.empty() && Record.back() == '\r' ) {
+            Record.remove_suffix(1);
+        }
+        this->SplitRecord(Record,Fields);
+        return true;
+    }
+
+    Char8 DelimitedReader::GetDelimiter() const noexcept
+        { return this->Delim; }
+
+    Char8 DelimitedReader::GetQuote() const noexcept
+        { return this->Quote; }
+}//Mezzanine
@@ -0,0 +1,131 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "EndianTools.h"
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief Swaps the remaining elements of an array one at a time.
+    /// @param Dest The array to write the swapped elements to.
+    /// @param Source The array of elements to swap.
+    /// @param Count The number of elements to swap.
+    /// @param ElementSize The size of each element in bytes.
+    void ScalarSwap(UInt8* Dest, const UInt8* Source, const size_t Count, const size_t ElementSize) noexcept
+    {
+        UInt8 Element[16];
+        for( size_t Index = 0 ; Index < Count ; ++Index )
+        {
+            // Copy first, so swapping in place works.
+            std::memcpy(Element,Source + Index * ElementSize,ElementSize);
+            std::reverse_copy(Element,Element + ElementSize,Dest + Index * ElementSize);
+        }
+    }
+
+#if defined(__SSSE3__)
+    /// @brief Gets a shuffle mask that reverses the bytes of each element in a 16 byte lane.
+    /// @param ElementSize The size of each element in bytes. Must divide 16.
+    /// @return Returns a mask for _mm_shuffle_epi8.
+    __m128i GetSwapMask128(const size_t ElementSize) noexcept
+    {
+        alignas(16) UInt8 Mask[16];
+        for( size_t Byte = 0 ; Byte < 16 ; ++Byte )
+        {
+            const size_t ElementStart = Byte - ( Byte % ElementSize );
+            Mask[Byte] = static_cast<UInt8>( ElementStart + ( ElementSize - 1 - ( Byte % ElementSize ) ) );
+        }
+        return _mm_load_si128(reinterpret_cast<const __m128i*>(Mask));
+    }
+#endif
+}
+
+namespace Mezzanine
+{
+    namespace EndianTools
+    {
+        void ByteSwapCopy(void* Dest, const void* Source, const size_t Count, const size_t ElementSize) noexcept
+        {
+            UInt8* Out = static_cast<UInt8*>(Dest);
+            const UInt8* In = static_cast<const UInt8*>(Source);
+            const size_t TotalBytes = Count * ElementSize;
+            size_t Done = 0;
+
+            if( ElementSize == 2 || ElementSize == 4 || ElementSize == 8 || ElementSize == 16 ) {
+            #if defined(__SSSE3__)
+                const __m128i Mask = GetSwapMask128(ElementSize);
+              #if defined(__AVX2__)
+                const __m256i WideMask = _mm256_broadcastsi128_si256(Mask);
+                for( ; Done + 32 <= TotalBytes ; Done += 32 )
+                {
+                    const __m256i Block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(In + Done));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + Done),_mm256_shuffle_epi8(Block,WideMask));
+                }
+              #endif
+                for( ; Done + 16 <= TotalBytes ; Done += 16 )
+                {
+                    const __m128i Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(In + Done));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(Out + Done),_mm_shuffle_epi8(Block,Mask));
+                }
+            #elif defined(__ARM_NEON)
+                for( ; Done + 16 <= TotalBytes ; Done += 16 )
+                {
+                    uint8x16_t Block = vld1q_u8(In + Done);
+                    switch( ElementSize )
+                    {
+                        case 2:   Block = vrev16q_u8(Block);                               break;
+                        case 4:   Block = vrev32q_u8(Block);                               break;
+                        case 8:   Block = vrev64q_u8(Block);                               break;
+                        default:  Block = vextq_u8(vrev64q_u8(Block),vrev64q_u8(Block),8);  break;
+                    }
+                    vst1q_u8(Out + Done,Block);
+                }
+            #endif
+            }
+            ScalarSwap(Out + Done,In + Done,( TotalBytes - Done ) / ElementSize,ElementSize);
+        }
+    }//EndianTools
+}//Mezzanine
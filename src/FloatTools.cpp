@@ -0,0 +1,269 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#include "FloatTools.h"
+
+#include <cstring>
+
+#if defined(__F16C__) && defined(__AVX__)
+    #include <immintrin.h>
+    #define MEZZ_HALF_FLOAT_F16C
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define MEZZ_HALF_FLOAT_NEON
+#endif
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief Gets the bits of a float.
+    /// @param Value The float to get the bits of.
+    /// @return Returns the IEEE representation of Value.
+    UInt32 FloatBits(const float Value) noexcept
+    {
+        UInt32 Bits;
+        std::memcpy(&Bits,&Value,sizeof(Bits));
+        return Bits;
+    }
+    /// @brief Makes a float from its bits.
+    /// @param Bits The IEEE representation of the float.
+    /// @return Returns the float.
+    float BitsFloat(const UInt32 Bits) noexcept
+    {
+        float Value;
+        std::memcpy(&Value,&Bits,sizeof(Value));
+        return Value;
+    }
+
+    /// @brief Clamps a value to a range, mapping NaN to zero.
+    /// @param Value The value to clamp.
+    /// @param Min The smallest value allowed.
+    /// @return Returns Value limited to the range [Min,1].
+    float ClampNormalized(const float Value, const float Min) noexcept
+    {
+        if( Value >= 1.0f ) {
+            return 1.0f;
+        }else if( Value <= Min ) {
+            return Min;
+        }
+        // NaN fails both comparisons above and is the only value not equal to itself.
+        return ( Value == Value ? Value : 0.0f );
+    }
+    /// @brief Encodes floats as signed normalized integers.
+    /// @tparam IntType The signed integer type to encode to.
+    /// @param In The floats to encode.
+    /// @param Count The number of floats.
+    /// @param Out The array to write the integers to.
+    template<typename IntType>
+    void EncodeSNorm(const float* In, const size_t Count, IntType* Out) noexcept
+    {
+        constexpr float Scale = static_cast<float>( ( 1 << ( sizeof(IntType) * 8 - 1 ) ) - 1 );
+        for( size_t Index = 0 ; Index < Count ; ++Index )
+        {
+            const float Scaled = ClampNormalized(In[Index],-1.0f) * Scale;
+            Out[Index] = static_cast<IntType>( Scaled + ( Scaled < 0.0f ? -0.5f : 0.5f ) );
+        }
+    }
+    /// @brief Decodes floats stored as signed normalized integers.
+    /// @tparam IntType The signed integer type to decode from.
+    /// @param In The integers to decode.
+    /// @param Count The number of integers.
+    /// @param Out The array to write the floats to.
+    template<typename IntType>
+    void DecodeSNorm(const IntType* In, const size_t Count, float* Out) noexcept
+    {
+        constexpr float Scale = 1.0f / static_cast<float>( ( 1 << ( sizeof(IntType) * 8 - 1 ) ) - 1 );
+        for( size_t Index = 0 ; Index < Count ; ++Index )
+        {
+            const float Value = static_cast<float>(In[Index]) * Scale;
+            Out[Index] = ( Value < -1.0f ? -1.0f : Value );
+        }
+    }
+    /// @brief Encodes floats as unsigned normalized integers.
+    /// @tparam IntType The unsigned integer type to encode to.
+    /// @param In The floats to encode.
+    /// @param Count The number of floats.
+    /// @param Out The array to write the integers to.
+    template<typename IntType>
+    void EncodeUNorm(const float* In, const size_t Count, IntType* Out) noexcept
+    {
+        constexpr float Scale = static_cast<float>( ( 1 << ( sizeof(IntType) * 8 ) ) - 1 );
+        for( size_t Index = 0 ; Index < Count ; ++Index )
+            { Out[Index] = static_cast<IntType>( ClampNormalized(In[Index],0.0f) * Scale + 0.5f ); }
+    }
+    /// @brief Decodes floats stored as unsigned normalized integers.
+    /// @tparam IntType The unsigned integer type to decode from.
+    /// @param In The integers to decode.
+    /// @param Count The number of integers.
+    /// @param Out The array to write the floats to.
+    template<typename IntType>
+    void DecodeUNorm(const IntType* In, const size_t Count, float* Out) noexcept
+    {
+        constexpr float Scale = 1.0f / static_cast<float>( ( 1 << ( sizeof(IntType) * 8 ) ) - 1 );
+        for( size_t Index = 0 ; Index < Count ; ++Index )
+            { Out[Index] = static_cast<float>(In[Index]) * Scale; }
+    }
+
+    /// @brief Converts an array of floats to half floats.
+    /// @param In The floats to convert.
+    /// @param Count The number of floats.
+    /// @param Out The array to write the half floats to.
+    void EncodeHalves(const float* In, const size_t Count, UInt16* Out) noexcept
+    {
+        size_t Index = 0;
+    #if defined(MEZZ_HALF_FLOAT_F16C)
+        for( ; Index + 8 <= Count ; Index += 8 )
+        {
+            const __m128i Halves = _mm256_cvtps_ph(_mm256_loadu_ps(In + Index),_MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(Out + Index),Halves);
+        }
+    #elif defined(MEZZ_HALF_FLOAT_NEON)
+        for( ; Index + 4 <= Count ; Index += 4 )
+            { vst1_u16(Out + Index,vreinterpret_u16_f16( vcvt_f16_f32( vld1q_f32(In + Index) ) )); }
+    #endif
+        for( ; Index < Count ; ++Index )
+            { Out[Index] = FloatTools::FloatToHalf(In[Index]); }
+    }
+    /// @brief Converts an array of half floats to floats.
+    /// @param In The half floats to convert.
+    /// @param Count The number of half floats.
+    /// @param Out The array to write the floats to.
+    void DecodeHalves(const UInt16* In, const size_t Count, float* Out) noexcept
+    {
+        size_t Index = 0;
+    #if defined(MEZZ_HALF_FLOAT_F16C)
+        for( ; Index + 8 <= Count ; Index += 8 )
+        {
+            const __m128i Halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(In + Index));
+            _mm256_storeu_ps(Out + Index,_mm256_cvtph_ps(Halves));
+        }
+    #elif defined(MEZZ_HALF_FLOAT_NEON)
+        for( ; Index + 4 <= Count ; Index += 4 )
+            { vst1q_f32(Out + Index,vcvt_f32_f16( vreinterpret_f16_u16( vld1_u16(In + Index) ) )); }
+    #endif
+        for( ; Index < Count ; ++Index )
+            { Out[Index] = FloatTools::HalfToFloat(In[Index]); }
+    }
+}
+
+namespace Mezzanine
+{
+    namespace FloatTools
+    {
+        UInt16 FloatToHalf(const float Value) noexcept
+        {
+            constexpr UInt32 FloatInfinity = 0xFFu << 23;
+            constexpr UInt32 HalfOverflow = ( 127u + 16u ) << 23;
+            constexpr UInt32 HalfMinNormal = 113u << 23;
+            // Adding 0.5 lines the mantissa of a subnormal half up with the low bits of the float, and lets
+            // the hardware do the round to nearest even.
+            constexpr UInt32 SubnormalMagic = 126u << 23;
+
+            UInt32 Bits = FloatBits(Value);
+            const UInt32 Sign = ( Bits >> 16 ) & 0x8000;
+            Bits &= 0x7FFFFFFF;
+
+            UInt32 Half;
+            if( Bits >= HalfOverflow ) {
+                Half = ( Bits > FloatInfinity ? 0x7E00 : 0x7C00 );
+            }else if( Bits < HalfMinNormal ) {
+                Half = FloatBits( BitsFloat(Bits) + BitsFloat(SubnormalMagic) ) - SubnormalMagic;
+            }else{
+                const UInt32 MantissaOdd = ( Bits >> 13 ) & 1;
+                // Rebias the exponent from 127 to 15 and round to nearest even in one addition.
+                Bits += ( 15u << 23 ) - ( 127u << 23 ) + 0xFFF + MantissaOdd;
+                Half = Bits >> 13;
+            }
+            return static_cast<UInt16>( Half | Sign );
+        }
+
+        float HalfToFloat(const UInt16 Half) noexcept
+        {
+            constexpr UInt32 ShiftedExponent = 0x7C00u << 13;
+            constexpr UInt32 SubnormalMagic = 113u << 23;
+
+            UInt32 Bits = static_cast<UInt32>( Half & 0x7FFF ) << 13;
+            const UInt32 Exponent = Bits & ShiftedExponent;
+            Bits += ( 127u - 15u ) << 23;
+            if( Exponent == ShiftedExponent ) {
+                // Infinity or NaN, push the exponent the rest of the way to all ones.
+                Bits += ( 128u - 16u ) << 23;
+            }else if( Exponent == 0 ) {
+                // Zero or subnormal, let the hardware normalize it.
+                Bits = FloatBits( BitsFloat( Bits + ( 1u << 23 ) ) - BitsFloat(SubnormalMagic) );
+            }
+            return BitsFloat( Bits | ( static_cast<UInt32>( Half & 0x8000 ) << 16 ) );
+        }
+
+        void EncodeFloats(const float* In, const size_t Count, const FloatEncoding Encoding, void* Out) noexcept
+        {
+            switch( Encoding )
+            {
+                case FloatEncoding::Float32:
+                    if( Count > 0 ) {
+                        std::memcpy(Out,In,Count * sizeof(float));
+                    }
+                    break;
+                case FloatEncoding::Half:     EncodeHalves(In,Count,static_cast<UInt16*>(Out));   break;
+                case FloatEncoding::SNorm8:   EncodeSNorm(In,Count,static_cast<Int8*>(Out));      break;
+                case FloatEncoding::UNorm8:   EncodeUNorm(In,Count,static_cast<UInt8*>(Out));     break;
+                case FloatEncoding::SNorm16:  EncodeSNorm(In,Count,static_cast<Int16*>(Out));     break;
+                case FloatEncoding::UNorm16:  EncodeUNorm(In,Count,static_cast<UInt16*>(Out));    break;
+            }
+        }
+
+        void DecodeFloats(const void* In, const size_t Count, const FloatEncoding Encoding, float* Out) noexcept
+        {
+            switch( Encoding )
+            {
+                case FloatEncoding::Float32:
+                    if( Count > 0 ) {
+                        std::memcpy(Out,In,Count * sizeof(float));
+                    }
+                    break;
+                case FloatEncoding::Half:     DecodeHalves(static_cast<const UInt16*>(In),Count,Out);   break;
+                case FloatEncoding::SNorm8:   DecodeSNorm(static_cast<const Int8*>(In),Count,Out);      break;
+                case FloatEncoding::UNorm8:   DecodeUNorm(static_cast<const UInt8*>(In),Count,Out);     break;
+                case FloatEncoding::SNorm16:  DecodeSNorm(static_cast<const Int16*>(In),Count,Out);     break;
+                case FloatEncoding::UNorm16:  DecodeUNorm(static_cast<const UInt16*>(In),Count,Out);    break;
+            }
+        }
+    }//FloatTools
+}//Mezzanine
@@ -39,6 +39,8 @@
 */
 
 #include "InputOutputStream.h"
+#include "StreamTools.h"
+#include "AsyncReadQueue.h"
 
 #include <cstring>
 
@@ -83,12 +85,37 @@ namespace Mezzanine
         return static_cast<size_t>( this->gcount() );
     }
 
+    StreamSize InputOutputStream::ReadV(const StreamReadSegment* Segments, const size_t Count)
+        { return StreamTools::ReadV(*this,Segments,Count); }
+
     size_t InputOutputStream::ReadLine(Char8* Buffer, const StreamSize Size, const Char8 Delim)
     {
         this->getline(Buffer,Size,Delim);
         return static_cast<size_t>( this->gcount() );
     }
 
+    StringView InputOutputStream::Peek(const StreamSize Size)
+        { return StreamTools::Peek(*this,Size,this->ViewBuffer); }
+
+    StringView InputOutputStream::Acquire(const StreamSize Size)
+        { return StreamTools::Acquire(*this,Size,this->ViewBuffer); }
+
+    StreamSize InputOutputStream::Consume(const StreamSize Size)
+        { return StreamTools::Consume(*this,Size); }
+
+    StreamSize InputOutputStream::ReadAt(const StreamPos Position, void* Buffer, const StreamSize Size)
+    {
+        std::lock_guard<std::mutex> Lock(this->PositionLock);
+        return StreamTools::ReadAt(*this,Position,Buffer,Size);
+    }
+
+    std::future<StreamSize> InputOutputStream::ReadAsync(const StreamPos Position, void* Buffer, const StreamSize Size)
+    {
+        return AsyncReadQueue::GetDefault().Submit([this,Position,Buffer,Size]() {
+            return this->ReadAt(Position,Buffer,Size);
+        });
+    }
+
     void InputOutputStream::SetReadPosition(StreamPos Position)
         { this->seekg(Position); }
 
@@ -110,6 +137,12 @@ namespace Mezzanine
         return this->good();
     }
 
+    Boole InputOutputStream::WriteV(const StreamWriteSegment* Segments, const size_t Count)
+    {
+        StreamTools::WriteV(*this,Segments,Count);
+        return this->good();
+    }
+
     void InputOutputStream::SetWritePosition(StreamPos Position)
         { this->seekp(Position); }
 
@@ -39,6 +39,8 @@
 */
 
 #include "InputStream.h"
+#include "StreamTools.h"
+#include "AsyncReadQueue.h"
 
 namespace Mezzanine
 {
@@ -73,12 +75,37 @@ namespace Mezzanine
         return static_cast<size_t>( this->gcount() );
     }
 
+    StreamSize InputStream::ReadV(const StreamReadSegment* Segments, const size_t Count)
+        { return StreamTools::ReadV(*this,Segments,Count); }
+
     size_t InputStream::ReadLine(Char8* Buffer, const StreamSize Size, const Char8 Delim)
     {
         this->getline(Buffer,Size,Delim);
         return static_cast<size_t>( this->gcount() );
     }
 
+    StringView InputStream::Peek(const StreamSize Size)
+        { return StreamTools::Peek(*this,Size,this->ViewBuffer); }
+
+    StringView InputStream::Acquire(const StreamSize Size)
+        { return StreamTools::Acquire(*this,Size,this->ViewBuffer); }
+
+    StreamSize InputStream::Consume(const StreamSize Size)
+        { return StreamTools::Consume(*this,Size); }
+
+    StreamSize InputStream::ReadAt(const StreamPos Position, void* Buffer, const StreamSize Size)
+    {
+        std::lock_guard<std::mutex> Lock(this->PositionLock);
+        return StreamTools::ReadAt(*this,Position,Buffer,Size);
+    }
+
+    std::future<StreamSize> InputStream::ReadAsync(const StreamPos Position, void* Buffer, const StreamSize Size)
+    {
+        return AsyncReadQueue::GetDefault().Submit([this,Position,Buffer,Size]() {
+            return this->ReadAt(Position,Buffer,Size);
+        });
+    }
+
     void InputStream::SetReadPosition(StreamPos Position)
         { this->seekg(Position); }
 
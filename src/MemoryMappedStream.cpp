@@ -0,0 +1,294 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "MemoryMappedStream.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // MemoryMappedBuffer Methods
+
+    MemoryMappedBuffer::~MemoryMappedBuffer()
+        { this->Close(); }
+
+    StreamPos MemoryMappedBuffer::MoveGetPointer(const StreamOff Position)
+    {
+        if( Position < 0 || Position > this->MappedSize ) {
+            return StreamPos(StreamOff(-1));
+        }
+        this->setg(this->MappedData,this->MappedData + Position,this->MappedData + this->MappedSize);
+        return StreamPos(Position);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Mapping
+
+    Boole MemoryMappedBuffer::Open(const String& File)
+    {
+        this->Close();
+
+    #ifdef _WIN32
+        HANDLE NewFile = ::CreateFileA(File.c_str(),GENERIC_READ,FILE_SHARE_READ,nullptr,OPEN_EXISTING,
+                                       FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,nullptr);
+        if( NewFile == INVALID_HANDLE_VALUE ) {
+            return false;
+        }
+        LARGE_INTEGER FileSize;
+        if( !::GetFileSizeEx(NewFile,&FileSize) ) {
+            ::CloseHandle(NewFile);
+            return false;
+        }
+        if( FileSize.QuadPart > 0 ) {
+            HANDLE NewMapping = ::CreateFileMappingA(NewFile,nullptr,PAGE_READONLY,0,0,nullptr);
+            if( NewMapping == nullptr ) {
+                ::CloseHandle(NewFile);
+                return false;
+            }
+            void* NewData = ::MapViewOfFile(NewMapping,FILE_MAP_READ,0,0,0);
+            if( NewData == nullptr ) {
+                ::CloseHandle(NewMapping);
+                ::CloseHandle(NewFile);
+                return false;
+            }
+            this->MappingHandle = NewMapping;
+            this->MappedData = static_cast<Char8*>(NewData);
+        }
+        this->FileHandle = NewFile;
+        this->MappedSize = static_cast<StreamSize>(FileSize.QuadPart);
+    #else
+        int NewFile = ::open(File.c_str(),O_RDONLY);
+        if( NewFile < 0 ) {
+            return false;
+        }
+        struct stat FileStats;
+        if( ::fstat(NewFile,&FileStats) != 0 || !S_ISREG(FileStats.st_mode) ) {
+            ::close(NewFile);
+            return false;
+        }
+        if( FileStats.st_size > 0 ) {
+            const size_t NewSize = static_cast<size_t>(FileStats.st_size);
+            void* NewData = ::mmap(nullptr,NewSize,PROT_READ,MAP_PRIVATE,NewFile,0);
+            if( NewData == MAP_FAILED ) {
+                ::close(NewFile);
+                return false;
+            }
+            // Our callers overwhelmingly read front to back, so let the kernel read ahead aggressively.
+            ::madvise(NewData,NewSize,MADV_SEQUENTIAL);
+            this->MappedData = static_cast<Char8*>(NewData);
+        }
+        // The mapping keeps its own reference to the file, so the descriptor isn't needed past this point.
+        ::close(NewFile);
+        this->MappedSize = static_cast<StreamSize>(FileStats.st_size);
+    #endif
+
+        this->FileName = File;
+        this->Opened = true;
+        this->MoveGetPointer(0);
+        return true;
+    }
+
+    void MemoryMappedBuffer::Close()
+    {
+        if( !this->Opened ) {
+            return;
+        }
+
+    #ifdef _WIN32
+        if( this->MappedData != nullptr ) {
+            ::UnmapViewOfFile(this->MappedData);
+        }
+        if( this->MappingHandle != nullptr ) {
+            ::CloseHandle(this->MappingHandle);
+        }
+        if( this->FileHandle != nullptr ) {
+            ::CloseHandle(this->FileHandle);
+        }
+        this->MappingHandle = nullptr;
+        this->FileHandle = nullptr;
+    #else
+        if( this->MappedData != nullptr ) {
+            ::munmap(this->MappedData,static_cast<size_t>(this->MappedSize));
+        }
+    #endif
+
+        this->setg(nullptr,nullptr,nullptr);
+        this->MappedData = nullptr;
+        this->MappedSize = 0;
+        this->FileName.clear();
+        this->Opened = false;
+    }
+
+    Boole MemoryMappedBuffer::IsOpen() const noexcept
+        { return this->Opened; }
+
+    const String& MemoryMappedBuffer::GetFileName() const noexcept
+        { return this->FileName; }
+
+    const Char8* MemoryMappedBuffer::GetData() const noexcept
+        { return this->MappedData; }
+
+    StreamSize MemoryMappedBuffer::GetSize() const noexcept
+        { return this->MappedSize; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Internal Buffer Operations
+
+    MemoryMappedBuffer::pos_type MemoryMappedBuffer::seekoff(off_type Offset,
+                                                             std::ios_base::seekdir Origin,
+                                                             std::ios_base::openmode Mode)
+    {
+        if( !( Mode & std::ios_base::in ) ) {
+            return pos_type(off_type(-1));
+        }
+
+        switch( Origin )
+        {
+            case std::ios_base::beg:  return this->MoveGetPointer(Offset);
+            case std::ios_base::cur:  return this->MoveGetPointer( ( this->gptr() - this->eback() ) + Offset );
+            case std::ios_base::end:  return this->MoveGetPointer(this->MappedSize + Offset);
+            default:                  return pos_type(off_type(-1));
+        }
+    }
+
+    MemoryMappedBuffer::pos_type MemoryMappedBuffer::seekpos(pos_type Position, std::ios_base::openmode Mode)
+        { return this->seekoff(off_type(Position),std::ios_base::beg,Mode); }
+
+    std::streamsize MemoryMappedBuffer::showmanyc()
+    {
+        // Returning -1 tells the Stream that underflow is certain to fail.
+        const std::streamsize Remaining = this->egptr() - this->gptr();
+        return ( Remaining > 0 ? Remaining : -1 );
+    }
+
+    std::streamsize MemoryMappedBuffer::xsgetn(char_type* Buffer, std::streamsize Count)
+    {
+        const std::streamsize ToCopy = std::min(Count,static_cast<std::streamsize>(this->egptr() - this->gptr()));
+        if( ToCopy > 0 ) {
+            std::memcpy(Buffer,this->gptr(),static_cast<size_t>(ToCopy));
+            this->setg(this->eback(),this->gptr() + ToCopy,this->egptr());
+        }
+        return ToCopy;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // MemoryMappedInputStream Methods
+
+    MemoryMappedInputStream::MemoryMappedInputStream() :
+        InputStream(&MappedBuffer)
+        {  }
+
+    MemoryMappedInputStream::MemoryMappedInputStream(const String& File) :
+        InputStream(&MappedBuffer)
+        { this->OpenFile(File); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // File Operations
+
+    void MemoryMappedInputStream::OpenFile(const String& File)
+    {
+        if( this->MappedBuffer.Open(File) ) {
+            this->clear();
+        }else{
+            this->setstate(std::ios_base::failbit);
+        }
+    }
+
+    void MemoryMappedInputStream::CloseFile()
+        { this->MappedBuffer.Close(); }
+
+    Boole MemoryMappedInputStream::IsOpen() const noexcept
+        { return this->MappedBuffer.IsOpen(); }
+
+    const Char8* MemoryMappedInputStream::GetData() const noexcept
+        { return this->MappedBuffer.GetData(); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Input Functions
+
+    StreamSize MemoryMappedInputStream::ReadAt(const StreamPos Position, void* Buffer, const StreamSize Size)
+    {
+        const StreamOff Start = StreamOff(Position);
+        const StreamSize MappedSize = this->MappedBuffer.GetSize();
+        if( Start < 0 || Start >= MappedSize || Size <= 0 ) {
+            return 0;
+        }
+        const StreamSize ToCopy = std::min(Size,MappedSize - Start);
+        std::memcpy(Buffer,this->MappedBuffer.GetData() + Start,static_cast<size_t>(ToCopy));
+        return ToCopy;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Stream Base Operations
+
+    String MemoryMappedInputStream::GetIdentifier() const
+        { return this->MappedBuffer.GetFileName(); }
+
+    String MemoryMappedInputStream::GetGroup() const
+        { return String(); }
+
+    StreamSize MemoryMappedInputStream::GetSize() const
+        { return this->MappedBuffer.GetSize(); }
+
+    Boole MemoryMappedInputStream::CanSeek() const
+        { return true; }
+
+    Boole MemoryMappedInputStream::IsEncrypted() const
+        { return false; }
+
+    Boole MemoryMappedInputStream::IsRaw() const
+        { return true; }
+}//Mezzanine
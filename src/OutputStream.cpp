@@ -39,6 +39,7 @@
 */
 
 #include "OutputStream.h"
+#include "StreamTools.h"
 
 namespace Mezzanine
 {
@@ -73,6 +74,12 @@ namespace Mezzanine
         return this->good();
     }
 
+    Boole OutputStream::WriteV(const StreamWriteSegment* Segments, const size_t Count)
+    {
+        StreamTools::WriteV(*this,Segments,Count);
+        return this->good();
+    }
+
     void OutputStream::SetWritePosition(StreamPos Position)
         { this->seekp(Position); }
 
@@ -0,0 +1,103 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#include "ParallelLineTools.h"
+#include "StreamTools.h"
+#include "MezzException.h"
+
+#include <algorithm>
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief Finds where the line containing a position ends.
+    /// @param Source The Stream to search.
+    /// @param From The position to start searching at.
+    /// @param Total The size of the Stream.
+    /// @param Delim The character that ends each line.
+    /// @return Returns the position just after the first delimiter at or after From, or Total if there isn't one.
+    StreamOff FindLineEnd(InputStreamBase& Source, StreamOff From, const StreamSize Total, const Char8 Delim)
+    {
+        Char8 Probe[4096];
+        while( From < Total )
+        {
+            const StreamSize ToRead = std::min(static_cast<StreamSize>( sizeof(Probe) ),Total - From);
+            const StreamSize Read = Source.ReadAt(StreamPos(From),Probe,ToRead);
+            if( Read <= 0 ) {
+                break;
+            }
+            const Char8* Found = StreamTools::FindCharacter(Probe,Probe + Read,Delim);
+            if( Found != Probe + Read ) {
+                return From + ( Found - Probe ) + 1;
+            }
+            From += Read;
+        }
+        return Total;
+    }
+}
+
+namespace Mezzanine
+{
+    namespace ParallelLineTools
+    {
+        std::vector<StreamRange> SplitLines(InputStreamBase& Source, const size_t RangeCount, const Char8 Delim)
+        {
+            if( !Source.CanSeek() ) {
+                MEZZ_EXCEPTION(StreamReadErrorCode,"Only Streams that can seek can be split into ranges of lines.")
+            }
+
+            const StreamSize Total = Source.GetSize();
+            const StreamSize Count = static_cast<StreamSize>( std::max(RangeCount,size_t(1)) );
+            std::vector<StreamRange> Ranges;
+            StreamOff Start = 0;
+            for( StreamSize Index = 1 ; Index <= Count && Start < Total ; ++Index )
+            {
+                StreamOff End = Total;
+                if( Index < Count ) {
+                    const StreamOff Target = ( Total / Count ) * Index + ( Total % Count ) * Index / Count;
+                    End = FindLineEnd(Source,std::max(Target,Start),Total,Delim);
+                }
+                Ranges.push_back( StreamRange{ Start, End - Start } );
+                Start = End;
+            }
+            return Ranges;
+        }
+    }//ParallelLineTools
+}//Mezzanine
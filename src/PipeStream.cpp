@@ -0,0 +1,360 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "PipeStream.h"
+
+#include <thread>
+
+namespace
+{
+    /// @brief The number of times to check for progress before sleeping under the Block wait policy.
+    constexpr Mezzanine::UInt32 PipeSpinLimit = 64;
+}
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // PipeRing Methods
+
+    PipeRing::PipeRing(const size_t MinCapacity, const PipeWaitPolicy Policy) :
+        Capacity(CacheLineSize),
+        WaitPolicy(Policy)
+    {
+        while( this->Capacity < MinCapacity )
+            { this->Capacity <<= 1; }
+        this->Mask = this->Capacity - 1;
+        this->Data.resize(this->Capacity);
+    }
+
+    template<typename Predicate>
+    void PipeRing::WaitUntil(Predicate Condition)
+    {
+        for( UInt32 Spins = 0 ; !Condition() ; ++Spins )
+        {
+            if( this->WaitPolicy == PipeWaitPolicy::Block && Spins >= PipeSpinLimit ) {
+                // Waiters is raised before the condition is checked under the lock, and the other end raises
+                // its position before checking Waiters, so one of the two will always see the other.
+                std::unique_lock<std::mutex> Lock(this->WaitLock);
+                this->Waiters.fetch_add(1);
+                this->WaitCondition.wait(Lock,Condition);
+                this->Waiters.fetch_sub(1);
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    void PipeRing::Notify()
+    {
+        if( this->Waiters.load() > 0 ) {
+            std::lock_guard<std::mutex> Lock(this->WaitLock);
+            this->WaitCondition.notify_all();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Query
+
+    size_t PipeRing::GetCapacity() const noexcept
+        { return this->Capacity; }
+
+    PipeWaitPolicy PipeRing::GetWaitPolicy() const noexcept
+        { return this->WaitPolicy; }
+
+    size_t PipeRing::GetBufferedSize() const noexcept
+        { return this->WritePosition.load() - this->ReadPosition.load(); }
+
+    Boole PipeRing::IsWriterClosed() const noexcept
+        { return this->WriterClosed.load(); }
+
+    Boole PipeRing::IsReaderClosed() const noexcept
+        { return this->ReaderClosed.load(); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Writer Interface
+
+    size_t PipeRing::GetWritable(Char8*& Start) noexcept
+    {
+        const size_t Written = this->WritePosition.load(std::memory_order_relaxed);
+        const size_t Free = this->Capacity - ( Written - this->ReadPosition.load(std::memory_order_acquire) );
+        const size_t Index = Written & this->Mask;
+        Start = this->Data.data() + Index;
+        return std::min(Free,this->Capacity - Index);
+    }
+
+    Boole PipeRing::WaitForSpace()
+    {
+        const size_t Written = this->WritePosition.load(std::memory_order_relaxed);
+        this->WaitUntil([this,Written](){
+            return this->ReaderClosed.load() || Written - this->ReadPosition.load() < this->Capacity;
+        });
+        return !this->ReaderClosed.load();
+    }
+
+    void PipeRing::CommitWrite(const size_t Count)
+    {
+        this->WritePosition.store( this->WritePosition.load(std::memory_order_relaxed) + Count );
+        this->Notify();
+    }
+
+    void PipeRing::CloseWriter()
+    {
+        this->WriterClosed.store(true);
+        this->Notify();
+    }
+
+    size_t PipeRing::GetWritePosition() const noexcept
+        { return this->WritePosition.load(); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Reader Interface
+
+    size_t PipeRing::GetReadable(Char8*& Start) noexcept
+    {
+        const size_t Read = this->ReadPosition.load(std::memory_order_relaxed);
+        const size_t Unread = this->WritePosition.load(std::memory_order_acquire) - Read;
+        const size_t Index = Read & this->Mask;
+        Start = this->Data.data() + Index;
+        return std::min(Unread,this->Capacity - Index);
+    }
+
+    Boole PipeRing::WaitForData()
+    {
+        const size_t Read = this->ReadPosition.load(std::memory_order_relaxed);
+        this->WaitUntil([this,Read](){
+            return this->WriterClosed.load() || this->WritePosition.load() != Read;
+        });
+        // The writer may have committed more data before closing, so check the position after the close.
+        return this->WritePosition.load() != Read;
+    }
+
+    void PipeRing::CommitRead(const size_t Count)
+    {
+        this->ReadPosition.store( this->ReadPosition.load(std::memory_order_relaxed) + Count );
+        this->Notify();
+    }
+
+    void PipeRing::CloseReader()
+    {
+        this->ReaderClosed.store(true);
+        this->Notify();
+    }
+
+    size_t PipeRing::GetReadPosition() const noexcept
+        { return this->ReadPosition.load(); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // PipeInputBuffer Methods
+
+    PipeInputBuffer::PipeInputBuffer(PipeRingPtr Pipe) :
+        Ring(std::move(Pipe))
+        {  }
+
+    PipeInputBuffer::~PipeInputBuffer()
+    {
+        this->ReleaseRead();
+        this->Ring->CloseReader();
+    }
+
+    void PipeInputBuffer::ReleaseRead()
+    {
+        const size_t Count = static_cast<size_t>( this->gptr() - this->eback() );
+        if( Count > 0 ) {
+            this->Ring->CommitRead(Count);
+            this->setg(this->gptr(),this->gptr(),this->egptr());
+        }
+    }
+
+    PipeInputBuffer::int_type PipeInputBuffer::underflow()
+    {
+        if( this->gptr() < this->egptr() ) {
+            return traits_type::to_int_type( *this->gptr() );
+        }
+
+        this->ReleaseRead();
+        if( !this->Ring->WaitForData() ) {
+            return traits_type::eof();
+        }
+        Char8* Start = nullptr;
+        const size_t Count = this->Ring->GetReadable(Start);
+        this->setg(Start,Start,Start + Count);
+        return traits_type::to_int_type( *this->gptr() );
+    }
+
+    std::streamsize PipeInputBuffer::showmanyc()
+    {
+        // Everything in the get area has been counted by the Ring, but not yet released.
+        const size_t Pending = this->Ring->GetBufferedSize() - static_cast<size_t>( this->egptr() - this->eback() );
+        if( Pending == 0 && this->Ring->IsWriterClosed() ) {
+            return -1;
+        }
+        return static_cast<std::streamsize>(Pending);
+    }
+
+    PipeInputBuffer::pos_type PipeInputBuffer::seekoff(off_type Offset, std::ios_base::seekdir Origin,
+                                                       std::ios_base::openmode Mode)
+    {
+        if( Offset != 0 || Origin != std::ios_base::cur || !( Mode & std::ios_base::in ) ) {
+            return pos_type(off_type(-1));
+        }
+        const size_t Consumed = static_cast<size_t>( this->gptr() - this->eback() );
+        return pos_type( static_cast<off_type>( this->Ring->GetReadPosition() + Consumed ) );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // PipeOutputBuffer Methods
+
+    PipeOutputBuffer::PipeOutputBuffer(PipeRingPtr Pipe) :
+        Ring(std::move(Pipe)),
+        MaxPutArea( std::max(this->Ring->GetCapacity() / 4,size_t(1)) )
+        {  }
+
+    PipeOutputBuffer::~PipeOutputBuffer()
+    {
+        this->PublishWrites();
+        this->Ring->CloseWriter();
+    }
+
+    void PipeOutputBuffer::PublishWrites()
+    {
+        const size_t Count = static_cast<size_t>( this->pptr() - this->pbase() );
+        if( Count > 0 ) {
+            this->Ring->CommitWrite(Count);
+            this->setp(this->pptr(),this->epptr());
+        }
+    }
+
+    PipeOutputBuffer::int_type PipeOutputBuffer::overflow(int_type Character)
+    {
+        this->PublishWrites();
+        if( traits_type::eq_int_type(Character,traits_type::eof()) ) {
+            return traits_type::not_eof(Character);
+        }
+
+        if( !this->Ring->WaitForSpace() ) {
+            return traits_type::eof();
+        }
+        Char8* Start = nullptr;
+        const size_t Count = std::min(this->Ring->GetWritable(Start),this->MaxPutArea);
+        this->setp(Start,Start + Count);
+        *this->pptr() = traits_type::to_char_type(Character);
+        this->pbump(1);
+        return Character;
+    }
+
+    int PipeOutputBuffer::sync()
+    {
+        this->PublishWrites();
+        return ( this->Ring->IsReaderClosed() ? -1 : 0 );
+    }
+
+    PipeOutputBuffer::pos_type PipeOutputBuffer::seekoff(off_type Offset, std::ios_base::seekdir Origin,
+                                                         std::ios_base::openmode Mode)
+    {
+        if( Offset != 0 || Origin != std::ios_base::cur || !( Mode & std::ios_base::out ) ) {
+            return pos_type(off_type(-1));
+        }
+        const size_t Pending = static_cast<size_t>( this->pptr() - this->pbase() );
+        return pos_type( static_cast<off_type>( this->Ring->GetWritePosition() + Pending ) );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // PipeInputStream Methods
+
+    PipeInputStream::PipeInputStream(PipeRingPtr Pipe) :
+        InputStream(&PipeBuffer),
+        Ring(Pipe),
+        PipeBuffer(Pipe)
+        {  }
+
+    String PipeInputStream::GetIdentifier() const
+        { return "Pipe"; }
+
+    String PipeInputStream::GetGroup() const
+        { return String(); }
+
+    StreamSize PipeInputStream::GetSize() const
+        { return static_cast<StreamSize>( this->Ring->GetBufferedSize() ); }
+
+    Boole PipeInputStream::CanSeek() const
+        { return false; }
+
+    Boole PipeInputStream::IsEncrypted() const
+        { return false; }
+
+    Boole PipeInputStream::IsRaw() const
+        { return true; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // PipeOutputStream Methods
+
+    PipeOutputStream::PipeOutputStream(PipeRingPtr Pipe) :
+        OutputStream(&PipeBuffer),
+        Ring(Pipe),
+        PipeBuffer(Pipe)
+        {  }
+
+    String PipeOutputStream::GetIdentifier() const
+        { return "Pipe"; }
+
+    String PipeOutputStream::GetGroup() const
+        { return String(); }
+
+    StreamSize PipeOutputStream::GetSize() const
+        { return static_cast<StreamSize>( this->Ring->GetBufferedSize() ); }
+
+    Boole PipeOutputStream::CanSeek() const
+        { return false; }
+
+    Boole PipeOutputStream::IsEncrypted() const
+        { return false; }
+
+    Boole PipeOutputStream::IsRaw() const
+        { return true; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Pipe Creation
+
+    std::pair<PipeInputStreamPtr,PipeOutputStreamPtr> CreatePipe(const size_t Capacity, const PipeWaitPolicy Policy)
+    {
+        PipeRingPtr Ring = std::make_shared<PipeRing>(Capacity,Policy);
+        return { MakePooledShared<PipeInputStream>(Ring), MakePooledShared<PipeOutputStream>(Ring) };
+    }
+}//Mezzanine
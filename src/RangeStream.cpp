@@ -0,0 +1,150 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#include "RangeStream.h"
+
+#include <algorithm>
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // RangeInputBuffer Methods
+
+    RangeInputBuffer::RangeInputBuffer(InputStreamBase& ToRead, const StreamRange ToReadRange, const size_t BufSize) :
+        Source(&ToRead),
+        Range(ToReadRange),
+        Buffer( BufferPool::Acquire(BufSize) ),
+        BufferSize(BufSize)
+        {  }
+
+    RangeInputBuffer::pos_type RangeInputBuffer::MoveGetPointer(const StreamOff Position)
+    {
+        if( Position < 0 || Position > this->Range.Size ) {
+            return pos_type(off_type(-1));
+        }
+        const StreamOff Loaded = this->egptr() - this->eback();
+        if( this->eback() != nullptr && Position >= this->BufferStart && Position <= this->BufferStart + Loaded ) {
+            this->setg(this->eback(),this->eback() + ( Position - this->BufferStart ),this->egptr());
+        }else{
+            this->BufferStart = Position;
+            this->setg(nullptr,nullptr,nullptr);
+        }
+        return pos_type(Position);
+    }
+
+    StreamRange RangeInputBuffer::GetRange() const noexcept
+        { return this->Range; }
+
+    RangeInputBuffer::int_type RangeInputBuffer::underflow()
+    {
+        if( this->gptr() < this->egptr() ) {
+            return traits_type::to_int_type(*this->gptr());
+        }
+        const StreamOff Next = this->BufferStart + ( this->egptr() - this->eback() );
+        const StreamSize ToRead = std::min(static_cast<StreamSize>(this->BufferSize),this->Range.Size - Next);
+        if( ToRead <= 0 ) {
+            return traits_type::eof();
+        }
+        Char8* Data = this->Buffer.get();
+        const StreamSize Read = this->Source->ReadAt(StreamPos(this->Range.Start + Next),Data,ToRead);
+        if( Read <= 0 ) {
+            return traits_type::eof();
+        }
+        this->BufferStart = Next;
+        this->setg(Data,Data,Data + Read);
+        return traits_type::to_int_type(*Data);
+    }
+
+    std::streamsize RangeInputBuffer::showmanyc()
+    {
+        const StreamOff Current = this->BufferStart + ( this->gptr() - this->eback() );
+        const StreamSize Remaining = this->Range.Size - Current;
+        return ( Remaining > 0 ? Remaining : -1 );
+    }
+
+    RangeInputBuffer::pos_type RangeInputBuffer::seekoff(off_type Offset,
+                                                         std::ios_base::seekdir Origin,
+                                                         std::ios_base::openmode Mode)
+    {
+        if( !( Mode & std::ios_base::in ) ) {
+            return pos_type(off_type(-1));
+        }
+
+        switch( Origin )
+        {
+            case std::ios_base::beg:  return this->MoveGetPointer(Offset);
+            case std::ios_base::cur:  return this->MoveGetPointer( this->BufferStart + ( this->gptr() - this->eback() ) + Offset );
+            case std::ios_base::end:  return this->MoveGetPointer(this->Range.Size + Offset);
+            default:                  return pos_type(off_type(-1));
+        }
+    }
+
+    RangeInputBuffer::pos_type RangeInputBuffer::seekpos(pos_type Position, std::ios_base::openmode Mode)
+        { return this->seekoff(off_type(Position),std::ios_base::beg,Mode); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // RangeInputStream Methods
+
+    RangeInputStream::RangeInputStream(InputStreamBase& ToRead, const StreamRange ToReadRange) :
+        InputStream(&RangeBuffer),
+        Source(&ToRead),
+        RangeBuffer(ToRead,ToReadRange)
+        {  }
+
+    StreamRange RangeInputStream::GetRange() const noexcept
+        { return this->RangeBuffer.GetRange(); }
+
+    String RangeInputStream::GetIdentifier() const
+        { return this->Source->GetIdentifier(); }
+
+    String RangeInputStream::GetGroup() const
+        { return this->Source->GetGroup(); }
+
+    StreamSize RangeInputStream::GetSize() const
+        { return this->RangeBuffer.GetRange().Size; }
+
+    Boole RangeInputStream::CanSeek() const
+        { return true; }
+
+    Boole RangeInputStream::IsEncrypted() const
+        { return this->Source->IsEncrypted(); }
+
+    Boole RangeInputStream::IsRaw() const
+        { return this->Source->IsRaw(); }
+}//Mezzanine
@@ -0,0 +1,459 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "ReadAheadStream.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // ReadAheadBuffer Methods
+
+    ReadAheadBuffer::ReadAheadBuffer(const StreamSize Window, const size_t BufferCount) :
+        Blocks( std::max(BufferCount,size_t(2)) ),
+        WindowSize( std::max(Window,StreamSize(1)) )
+    {
+        for( ReadBlock& Block : this->Blocks )
+        {
+            Block.Data = BufferPool::Acquire( static_cast<size_t>(this->WindowSize) );
+            this->FreeBlocks.push_back(&Block);
+        }
+    }
+
+    ReadAheadBuffer::ReadAheadBuffer(std::streambuf* Src, const StreamSize Window, const size_t BufferCount) :
+        ReadAheadBuffer(Window,BufferCount)
+        { this->SetSource(Src); }
+
+    ReadAheadBuffer::~ReadAheadBuffer()
+        { this->StopPrefetcher(); }
+
+    void ReadAheadBuffer::PrefetchData()
+    {
+        std::unique_lock<std::mutex> Lock(this->BlockLock);
+        while( true )
+        {
+            this->BlockCondition.wait(Lock,[this](){
+                return this->ShuttingDown ||
+                       ( this->PrefetchEnabled && !this->SourceEnded && !this->FreeBlocks.empty() );
+            });
+            if( this->ShuttingDown ) {
+                return;
+            }
+
+            ReadBlock* Block = this->FreeBlocks.back();
+            this->FreeBlocks.pop_back();
+            const UInt64 FillGeneration = this->Generation;
+            const StreamOff FillStart = this->NextFillStart;
+            this->Filling = true;
+
+            Lock.unlock();
+            const StreamSize BytesRead = this->Source->sgetn(Block->Data.get(),this->WindowSize);
+            Lock.lock();
+
+            this->Filling = false;
+            if( FillGeneration == this->Generation && BytesRead > 0 ) {
+                Block->Start = FillStart;
+                Block->Size = BytesRead;
+                this->NextFillStart += BytesRead;
+                this->ReadyBlocks.push_back(Block);
+            }else{
+                this->FreeBlocks.push_back(Block);
+            }
+            if( FillGeneration == this->Generation && BytesRead < this->WindowSize ) {
+                this->SourceEnded = true;
+            }
+            this->BlockCondition.notify_all();
+        }
+    }
+
+    void ReadAheadBuffer::StartPrefetcher()
+    {
+        this->ShuttingDown = false;
+        this->Prefetcher = std::thread([this](){ this->PrefetchData(); });
+    }
+
+    void ReadAheadBuffer::StopPrefetcher()
+    {
+        if( !this->Prefetcher.joinable() ) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> Lock(this->BlockLock);
+            this->ShuttingDown = true;
+        }
+        this->BlockCondition.notify_all();
+        this->Prefetcher.join();
+    }
+
+    void ReadAheadBuffer::DiscardBlocks()
+    {
+        if( this->Current != nullptr ) {
+            this->FreeBlocks.push_back(this->Current);
+            this->Current = nullptr;
+        }
+        for( ReadBlock* Block : this->ReadyBlocks )
+        {
+            this->FreeBlocks.push_back(Block);
+        }
+        this->ReadyBlocks.clear();
+        this->setg(nullptr,nullptr,nullptr);
+    }
+
+    void ReadAheadBuffer::UseBlock(ReadBlock* Block, const StreamOff Offset)
+    {
+        this->Current = Block;
+        this->CurrentStart = Block->Start;
+        Char8* Data = Block->Data.get();
+        this->setg(Data,Data + Offset,Data + Block->Size);
+    }
+
+    ReadAheadBuffer::pos_type ReadAheadBuffer::MoveTo(const StreamOff Position,
+                                                      std::ios_base::seekdir Origin,
+                                                      const StreamOff Offset)
+    {
+        const pos_type Invalid = pos_type(off_type(-1));
+        std::unique_lock<std::mutex> Lock(this->BlockLock);
+        if( this->Source == nullptr ) {
+            return Invalid;
+        }
+
+        if( Origin != std::ios_base::end ) {
+            if( Position < 0 ) {
+                return Invalid;
+            }
+            // Inside the get area, just move the pointer.
+            const StreamOff AreaSize = this->egptr() - this->eback();
+            if( Position >= this->CurrentStart && Position <= this->CurrentStart + AreaSize ) {
+                this->setg(this->eback(),this->eback() + ( Position - this->CurrentStart ),this->egptr());
+                return pos_type(Position);
+            }
+            // Ahead into data that was prefetched, skip the blocks before it.
+            auto IsInBlock = [Position](ReadBlock* Block) {
+                return Position >= Block->Start && Position < Block->Start + Block->Size;
+            };
+            auto Found = std::find_if(this->ReadyBlocks.begin(),this->ReadyBlocks.end(),IsInBlock);
+            if( Position > this->CurrentStart && Found != this->ReadyBlocks.end() ) {
+                if( this->Current != nullptr ) {
+                    this->FreeBlocks.push_back(this->Current);
+                }
+                ReadBlock* Block = *Found;
+                this->FreeBlocks.insert(this->FreeBlocks.end(),this->ReadyBlocks.begin(),Found);
+                this->ReadyBlocks.erase(this->ReadyBlocks.begin(),Found + 1);
+                this->UseBlock(Block,Position - Block->Start);
+                this->BlockCondition.notify_all();
+                return pos_type(Position);
+            }
+        }
+
+        // Outside of the buffered data. Pause the prefetcher, throw out everything and reposition the source.
+        const StreamOff SavedPosition = this->CurrentStart + ( this->gptr() - this->eback() );
+        this->PrefetchEnabled = false;
+        ++(this->Generation);
+        this->BlockCondition.wait(Lock,[this](){ return !this->Filling; });
+        this->DiscardBlocks();
+
+        pos_type Result = ( Origin == std::ios_base::end ?
+                            this->Source->pubseekoff(Offset,std::ios_base::end,std::ios_base::in) :
+                            this->Source->pubseekpos(pos_type(Position),std::ios_base::in) );
+        if( Result == Invalid ) {
+            this->Source->pubseekpos(pos_type(SavedPosition),std::ios_base::in);
+            this->CurrentStart = SavedPosition;
+        }else{
+            this->CurrentStart = off_type(Result);
+        }
+        this->NextFillStart = this->CurrentStart;
+        this->SourceEnded = false;
+
+        this->SequentialReads = 0;
+        ++(this->RandomSeeks);
+        this->PrefetchEnabled = ( this->RandomSeeks < RandomSeekThreshold );
+        this->BlockCondition.notify_all();
+        return Result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Configuration
+
+    void ReadAheadBuffer::SetSource(std::streambuf* Src)
+    {
+        this->StopPrefetcher();
+
+        this->DiscardBlocks();
+        this->Source = Src;
+        ++(this->Generation);
+        this->RandomSeeks = 0;
+        this->SequentialReads = 0;
+        this->PrefetchEnabled = true;
+        this->SourceEnded = ( Src == nullptr );
+
+        StreamOff Start = 0;
+        if( Src != nullptr ) {
+            Start = std::max(off_type( Src->pubseekoff(0,std::ios_base::cur,std::ios_base::in) ),off_type(0));
+        }
+        this->CurrentStart = Start;
+        this->NextFillStart = Start;
+
+        if( Src != nullptr ) {
+            this->StartPrefetcher();
+        }
+    }
+
+    std::streambuf* ReadAheadBuffer::GetSource() const noexcept
+        { return this->Source; }
+
+    StreamSize ReadAheadBuffer::GetWindowSize() const noexcept
+        { return this->WindowSize; }
+
+    size_t ReadAheadBuffer::GetBufferCount() const noexcept
+        { return this->Blocks.size(); }
+
+    Boole ReadAheadBuffer::IsPrefetching()
+    {
+        std::lock_guard<std::mutex> Lock(this->BlockLock);
+        return this->PrefetchEnabled;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Positional Reads
+
+    StreamSize ReadAheadBuffer::ReadAt(const StreamOff Position, Char8* Buffer, const StreamSize Size)
+    {
+        const pos_type Invalid = pos_type(off_type(-1));
+        std::unique_lock<std::mutex> Lock(this->BlockLock);
+        if( this->Source == nullptr || Position < 0 || Size <= 0 ) {
+            return 0;
+        }
+
+        // The current and ready blocks are contiguous and in order, so copy from each in turn.
+        StreamSize Copied = 0;
+        auto CopyFrom = [&](const ReadBlock* Block) {
+            const StreamOff Wanted = Position + Copied;
+            if( Copied < Size && Wanted >= Block->Start && Wanted < Block->Start + Block->Size ) {
+                const StreamSize Count = std::min(Size - Copied,Block->Start + Block->Size - Wanted);
+                std::memcpy(Buffer + Copied,Block->Data.get() + ( Wanted - Block->Start ),static_cast<size_t>(Count));
+                Copied += Count;
+            }
+        };
+        if( this->Current != nullptr ) {
+            CopyFrom(this->Current);
+        }
+        for( const ReadBlock* Block : this->ReadyBlocks )
+            { CopyFrom(Block); }
+        if( Copied >= Size ) {
+            return Copied;
+        }
+
+        // Holding the lock keeps the prefetcher from starting another fill while the source is borrowed.
+        this->BlockCondition.wait(Lock,[this](){ return !this->Filling; });
+        const pos_type Saved = this->Source->pubseekoff(0,std::ios_base::cur,std::ios_base::in);
+        if( Saved == Invalid || this->Source->pubseekpos(pos_type(Position + Copied),std::ios_base::in) == Invalid ) {
+            return Copied;
+        }
+        Copied += std::max(this->Source->sgetn(Buffer + Copied,Size - Copied),StreamSize(0));
+        if( this->Source->pubseekpos(Saved,std::ios_base::in) == Invalid ) {
+            // Further fills would come from the wrong place, so stop reading from the source.
+            this->SourceEnded = true;
+            return -1;
+        }
+        return Copied;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Internal Buffer Operations
+
+    ReadAheadBuffer::int_type ReadAheadBuffer::underflow()
+    {
+        if( this->gptr() < this->egptr() ) {
+            return traits_type::to_int_type( *( this->gptr() ) );
+        }
+
+        std::unique_lock<std::mutex> Lock(this->BlockLock);
+        if( this->Source == nullptr ) {
+            return traits_type::eof();
+        }
+
+        // Hand the exhausted block back to the prefetcher.
+        const StreamOff NextStart = this->CurrentStart + ( this->egptr() - this->eback() );
+        if( this->Current != nullptr ) {
+            this->FreeBlocks.push_back(this->Current);
+            this->Current = nullptr;
+        }
+        this->setg(nullptr,nullptr,nullptr);
+        this->CurrentStart = NextStart;
+
+        if( ++(this->SequentialReads) >= SequentialReadThreshold ) {
+            this->RandomSeeks = 0;
+            this->PrefetchEnabled = true;
+        }
+        this->BlockCondition.notify_all();
+
+        if( this->PrefetchEnabled ) {
+            this->BlockCondition.wait(Lock,[this](){
+                return !this->ReadyBlocks.empty() || ( this->SourceEnded && !this->Filling );
+            });
+        }else{
+            this->BlockCondition.wait(Lock,[this](){ return !this->Filling; });
+        }
+
+        ReadBlock* Next = nullptr;
+        if( !this->ReadyBlocks.empty() ) {
+            Next = this->ReadyBlocks.front();
+            this->ReadyBlocks.pop_front();
+        }else if( !this->PrefetchEnabled && !this->SourceEnded ) {
+            // Random access, read only what is needed right now on this thread.
+            Next = this->FreeBlocks.back();
+            this->FreeBlocks.pop_back();
+            Next->Start = this->NextFillStart;
+            Next->Size = this->Source->sgetn(Next->Data.get(),this->WindowSize);
+            this->NextFillStart += Next->Size;
+            this->SourceEnded = ( Next->Size < this->WindowSize );
+            if( Next->Size <= 0 ) {
+                this->FreeBlocks.push_back(Next);
+                Next = nullptr;
+            }
+        }
+
+        if( Next == nullptr ) {
+            return traits_type::eof();
+        }
+        this->UseBlock(Next,0);
+        return traits_type::to_int_type( *( this->gptr() ) );
+    }
+
+    ReadAheadBuffer::pos_type ReadAheadBuffer::seekoff(off_type Offset,
+                                                       std::ios_base::seekdir Origin,
+                                                       std::ios_base::openmode Mode)
+    {
+        if( !( Mode & std::ios_base::in ) ) {
+            return pos_type(off_type(-1));
+        }
+
+        const StreamOff CurrentPosition = this->CurrentStart + ( this->gptr() - this->eback() );
+        switch( Origin )
+        {
+            case std::ios_base::beg:  return this->MoveTo(Offset,Origin,Offset);
+            case std::ios_base::cur:  return this->MoveTo(CurrentPosition + Offset,Origin,Offset);
+            case std::ios_base::end:  return this->MoveTo(0,Origin,Offset);
+            default:                  return pos_type(off_type(-1));
+        }
+    }
+
+    ReadAheadBuffer::pos_type ReadAheadBuffer::seekpos(pos_type Position, std::ios_base::openmode Mode)
+        { return this->seekoff(off_type(Position),std::ios_base::beg,Mode); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ReadAheadInputStream Methods
+
+    ReadAheadInputStream::ReadAheadInputStream(const StreamSize Window, const size_t BufferCount) :
+        InputStream(&ReadBuffer),
+        ReadBuffer(Window,BufferCount)
+        {  }
+
+    ReadAheadInputStream::ReadAheadInputStream(const String& File, const StreamSize Window, const size_t BufferCount) :
+        InputStream(&ReadBuffer),
+        ReadBuffer(Window,BufferCount)
+        { this->OpenFile(File); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // File Operations
+
+    void ReadAheadInputStream::OpenFile(const String& File)
+    {
+        this->CloseFile();
+        if( this->FileBuffer.open(File,std::ios_base::in | std::ios_base::binary) == nullptr ) {
+            this->setstate(std::ios_base::failbit);
+            return;
+        }
+
+        const StreamPos End = this->FileBuffer.pubseekoff(0,std::ios_base::end,std::ios_base::in);
+        this->FileBuffer.pubseekpos(0,std::ios_base::in);
+        this->FileSize = std::max(StreamOff(End),StreamOff(0));
+        this->FileName = File;
+        this->ReadBuffer.SetSource(&FileBuffer);
+        this->clear();
+    }
+
+    void ReadAheadInputStream::CloseFile()
+    {
+        this->ReadBuffer.SetSource(nullptr);
+        this->FileBuffer.close();
+        this->FileName.clear();
+        this->FileSize = 0;
+    }
+
+    Boole ReadAheadInputStream::IsOpen() const
+        { return this->FileBuffer.is_open(); }
+
+    Boole ReadAheadInputStream::IsPrefetching()
+        { return this->ReadBuffer.IsPrefetching(); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Input Functions
+
+    StreamSize ReadAheadInputStream::ReadAt(const StreamPos Position, void* Buffer, const StreamSize Size)
+    {
+        // This may be running on another thread, so a failure is only reported through the return value.
+        const StreamSize BytesRead = this->ReadBuffer.ReadAt(StreamOff(Position),static_cast<Char8*>(Buffer),Size);
+        return std::max(BytesRead,StreamSize(0));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Stream Base Operations
+
+    String ReadAheadInputStream::GetIdentifier() const
+        { return this->FileName; }
+
+    String ReadAheadInputStream::GetGroup() const
+        { return String(); }
+
+    StreamSize ReadAheadInputStream::GetSize() const
+        { return this->FileSize; }
+
+    Boole ReadAheadInputStream::CanSeek() const
+        { return true; }
+
+    Boole ReadAheadInputStream::IsEncrypted() const
+        { return false; }
+
+    Boole ReadAheadInputStream::IsRaw() const
+        { return true; }
+}//Mezzanine
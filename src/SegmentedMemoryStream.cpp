@@ -0,0 +1,251 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "SegmentedMemoryStream.h"
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // SegmentedMemoryBuffer Methods
+
+    SegmentedMemoryBuffer::SegmentedMemoryBuffer(const size_t SegSize) :
+        SegmentSize( std::max(SegSize,size_t(1)) )
+        {  }
+
+    SegmentedMemoryBuffer::~SegmentedMemoryBuffer()
+        { this->Clear(); }
+
+    void SegmentedMemoryBuffer::UpdateDataSize()
+        { this->DataSize = this->GetDataSize(); }
+
+    StreamSize SegmentedMemoryBuffer::GetReadPos() const
+        { return this->ReadBase + ( this->gptr() - this->eback() ); }
+
+    StreamSize SegmentedMemoryBuffer::GetWritePos() const
+    {
+        const StreamSize SegmentStart = static_cast<StreamSize>(this->WriteSegment * this->SegmentSize);
+        return SegmentStart + ( this->pptr() - this->pbase() );
+    }
+
+    void SegmentedMemoryBuffer::MoveReadTo(const StreamSize Position)
+    {
+        const size_t Index = static_cast<size_t>(Position) / this->SegmentSize;
+        if( Index >= this->Segments.size() ) {
+            // Only reachable when the position is the end of the data and the last segment is full.
+            this->ReadBase = Position;
+            this->setg(nullptr,nullptr,nullptr);
+            return;
+        }
+        this->ReadBase = static_cast<StreamSize>(Index * this->SegmentSize);
+        const size_t Offset = static_cast<size_t>(Position - this->ReadBase);
+        const size_t Limit = std::min( this->SegmentSize, static_cast<size_t>(this->DataSize - this->ReadBase) );
+        Char8* Segment = this->Segments[Index].get();
+        this->setg(Segment,Segment + Offset,Segment + Limit);
+    }
+
+    void SegmentedMemoryBuffer::MoveWriteTo(const StreamSize Position)
+    {
+        const size_t Index = static_cast<size_t>(Position) / this->SegmentSize;
+        if( Index >= this->Segments.size() ) {
+            this->Segments.push_back( BufferPool::Acquire(this->SegmentSize) );
+        }
+        this->WriteSegment = Index;
+        Char8* Segment = this->Segments[Index].get();
+        this->setp(Segment,Segment + this->SegmentSize);
+        this->pbump( static_cast<int>( static_cast<size_t>(Position) - Index * this->SegmentSize ) );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Segment Access
+
+    StreamSize SegmentedMemoryBuffer::GetDataSize() const
+        { return std::max(this->DataSize,this->GetWritePos()); }
+
+    size_t SegmentedMemoryBuffer::GetSegmentSize() const noexcept
+        { return this->SegmentSize; }
+
+    std::vector<StreamWriteSegment> SegmentedMemoryBuffer::GetSegments()
+    {
+        this->UpdateDataSize();
+        std::vector<StreamWriteSegment> Ret;
+        Ret.reserve( this->Segments.size() );
+        StreamSize Remaining = this->DataSize;
+        for( const BufferPool::BufferPtr& Segment : this->Segments )
+        {
+            if( Remaining <= 0 ) {
+                break;
+            }
+            const StreamSize Count = std::min(Remaining,static_cast<StreamSize>(this->SegmentSize));
+            Ret.push_back( { Segment.get(), Count } );
+            Remaining -= Count;
+        }
+        return Ret;
+    }
+
+    void SegmentedMemoryBuffer::Clear()
+    {
+        this->Segments.clear();
+        this->DataSize = 0;
+        this->ReadBase = 0;
+        this->WriteSegment = 0;
+        this->setg(nullptr,nullptr,nullptr);
+        this->setp(nullptr,nullptr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Streambuf Overrides
+
+    SegmentedMemoryBuffer::int_type SegmentedMemoryBuffer::underflow()
+    {
+        if( this->gptr() < this->egptr() ) {
+            return traits_type::to_int_type( *this->gptr() );
+        }
+        this->UpdateDataSize();
+        const StreamSize Position = this->GetReadPos();
+        if( Position >= this->DataSize ) {
+            return traits_type::eof();
+        }
+        this->MoveReadTo(Position);
+        return traits_type::to_int_type( *this->gptr() );
+    }
+
+    SegmentedMemoryBuffer::int_type SegmentedMemoryBuffer::overflow(int_type Character)
+    {
+        if( traits_type::eq_int_type(Character,traits_type::eof()) ) {
+            return traits_type::not_eof(Character);
+        }
+        this->UpdateDataSize();
+        this->MoveWriteTo( this->GetWritePos() );
+        *this->pptr() = traits_type::to_char_type(Character);
+        this->pbump(1);
+        return Character;
+    }
+
+    std::streamsize SegmentedMemoryBuffer::showmanyc()
+    {
+        const StreamSize Remaining = this->GetDataSize() - this->GetReadPos();
+        return ( Remaining > 0 ? Remaining : -1 );
+    }
+
+    SegmentedMemoryBuffer::pos_type SegmentedMemoryBuffer::seekoff(off_type Offset, std::ios_base::seekdir Origin,
+                                                                   std::ios_base::openmode Mode)
+    {
+        const Boole SeekRead = ( Mode & std::ios_base::in );
+        const Boole SeekWrite = ( Mode & std::ios_base::out );
+        if( Origin == std::ios_base::cur && SeekRead && SeekWrite ) {
+            // Ambiguous which position is meant, same as std::stringbuf.
+            return pos_type(off_type(-1));
+        }
+
+        this->UpdateDataSize();
+        StreamSize Base = 0;
+        switch( Origin )
+        {
+            case std::ios_base::beg:  Base = 0;                                                          break;
+            case std::ios_base::cur:  Base = ( SeekRead ? this->GetReadPos() : this->GetWritePos() );    break;
+            case std::ios_base::end:  Base = this->DataSize;                                             break;
+            default:                  return pos_type(off_type(-1));
+        }
+        return this->seekpos(pos_type(Base + Offset),Mode);
+    }
+
+    SegmentedMemoryBuffer::pos_type SegmentedMemoryBuffer::seekpos(pos_type Position, std::ios_base::openmode Mode)
+    {
+        this->UpdateDataSize();
+        const StreamSize Target = static_cast<StreamSize>(Position);
+        if( Target < 0 || Target > this->DataSize || !( Mode & ( std::ios_base::in | std::ios_base::out ) ) ) {
+            return pos_type(off_type(-1));
+        }
+        if( Mode & std::ios_base::in ) {
+            this->MoveReadTo(Target);
+        }
+        if( Mode & std::ios_base::out ) {
+            this->MoveWriteTo(Target);
+        }
+        return Position;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SegmentedMemoryStream Methods
+
+    SegmentedMemoryStream::SegmentedMemoryStream(const size_t SegSize) :
+        InputOutputStream(&SegmentBuffer),
+        SegmentBuffer(SegSize)
+        {  }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Segment Access
+
+    std::vector<StreamWriteSegment> SegmentedMemoryStream::GetSegments()
+        { return this->SegmentBuffer.GetSegments(); }
+
+    Boole SegmentedMemoryStream::WriteTo(OutputStreamBase& Dest)
+    {
+        const std::vector<StreamWriteSegment> Data = this->SegmentBuffer.GetSegments();
+        return Dest.WriteV(Data.data(),Data.size());
+    }
+
+    void SegmentedMemoryStream::Clear()
+    {
+        this->SegmentBuffer.Clear();
+        this->clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Stream Base Operations
+
+    String SegmentedMemoryStream::GetIdentifier() const
+        { return "SegmentedMemory"; }
+
+    String SegmentedMemoryStream::GetGroup() const
+        { return String(); }
+
+    StreamSize SegmentedMemoryStream::GetSize() const
+        { return this->SegmentBuffer.GetDataSize(); }
+
+    Boole SegmentedMemoryStream::CanSeek() const
+        { return true; }
+
+    Boole SegmentedMemoryStream::IsEncrypted() const
+        { return false; }
+
+    Boole SegmentedMemoryStream::IsRaw() const
+        { return true; }
+}//Mezzanine
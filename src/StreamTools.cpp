@@ -0,0 +1,266 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "StreamTools.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief Gets the index of the lowest set bit.
+    /// @param Value The value to check. Must not be 0.
+    /// @return Returns the number of zero bits below the lowest set bit.
+    [[maybe_unused]] size_t CountTrailingZeros(const UInt64 Value) noexcept
+    {
+    #if defined(_MSC_VER)
+        unsigned long Index = 0;
+        _BitScanForward64(&Index,Value);
+        return Index;
+    #else
+        return static_cast<size_t>( __builtin_ctzll(Value) );
+    #endif
+    }
+}
+
+namespace Mezzanine
+{
+namespace StreamTools
+{
+    const Char8* FindCharacter(const Char8* Begin, const Char8* End, const Char8 Target) noexcept
+    {
+        const Char8* Current = Begin;
+    #if defined(__AVX2__)
+        const __m256i WideNeedle = _mm256_set1_epi8(Target);
+        for( ; End - Current >= 32 ; Current += 32 )
+        {
+            const __m256i Block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Current));
+            const UInt32 Matches = static_cast<UInt32>( _mm256_movemask_epi8( _mm256_cmpeq_epi8(Block,WideNeedle) ) );
+            if( Matches != 0 ) {
+                return Current + CountTrailingZeros(Matches);
+            }
+        }
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64)
+        const __m128i Needle = _mm_set1_epi8(Target);
+        for( ; End - Current >= 16 ; Current += 16 )
+        {
+            const __m128i Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Current));
+            const UInt32 Matches = static_cast<UInt32>( _mm_movemask_epi8( _mm_cmpeq_epi8(Block,Needle) ) );
+            if( Matches != 0 ) {
+                return Current + CountTrailingZeros(Matches);
+            }
+        }
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        const uint8x16_t Needle = vdupq_n_u8( static_cast<UInt8>(Target) );
+        for( ; End - Current >= 16 ; Current += 16 )
+        {
+            const uint8x16_t Block = vld1q_u8(reinterpret_cast<const UInt8*>(Current));
+            // NEON has no movemask, so narrow each byte of the comparison to 4 bits to fit it in 64 bits.
+            const uint8x8_t Narrowed = vshrn_n_u16(vreinterpretq_u16_u8( vceqq_u8(Block,Needle) ),4);
+            const UInt64 Matches = vget_lane_u64(vreinterpret_u64_u8(Narrowed),0);
+            if( Matches != 0 ) {
+                return Current + CountTrailingZeros(Matches) / 4;
+            }
+        }
+    #endif
+        for( ; Current < End ; ++Current )
+        {
+            if( *Current == Target ) {
+                return Current;
+            }
+        }
+        return End;
+    }
+
+    StringView Peek(std::istream& Stream, const StreamSize Size, std::vector<Char8>& Scratch)
+    {
+        if( !Stream.good() || Size <= 0 ) {
+            return StringView();
+        }
+
+        std::streambuf* Buf = Stream.rdbuf();
+        using TraitsType = std::streambuf::traits_type;
+        if( GetAvailable(Buf) <= 0 && TraitsType::eq_int_type(Buf->sgetc(),TraitsType::eof()) ) {
+            Stream.setstate(std::ios_base::eofbit);
+            return StringView();
+        }
+
+        const StreamSize Available = GetAvailable(Buf);
+        if( Available >= Size ) {
+            return StringView(StreamBufferAccess::GetCurrent(Buf),static_cast<size_t>(Size));
+        }
+
+        // The requested range straddles the end of the buffer, copy it out and seek back if we can.
+        const StreamPos Start = Buf->pubseekoff(0,std::ios_base::cur,std::ios_base::in);
+        if( Start == StreamPos(StreamOff(-1)) ) {
+            return StringView(StreamBufferAccess::GetCurrent(Buf),static_cast<size_t>(Available));
+        }
+        Scratch.resize(static_cast<size_t>(Size));
+        const StreamSize Copied = Buf->sgetn(Scratch.data(),Size);
+        if( Buf->pubseekpos(Start,std::ios_base::in) == StreamPos(StreamOff(-1)) ) {
+            Stream.setstate(std::ios_base::badbit);
+            return StringView();
+        }
+        return StringView(Scratch.data(),static_cast<size_t>(Copied));
+    }
+
+    StringView Acquire(std::istream& Stream, const StreamSize Size, std::vector<Char8>& Scratch)
+    {
+        if( !Stream.good() || Size <= 0 ) {
+            return StringView();
+        }
+
+        std::streambuf* Buf = Stream.rdbuf();
+        if( GetAvailable(Buf) >= Size ) {
+            StringView Ret(StreamBufferAccess::GetCurrent(Buf),static_cast<size_t>(Size));
+            StreamBufferAccess::GetAdvance(Buf,Size);
+            return Ret;
+        }
+
+        Scratch.resize(static_cast<size_t>(Size));
+        const StreamSize Copied = Buf->sgetn(Scratch.data(),Size);
+        if( Copied < Size ) {
+            Stream.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+        }
+        return StringView(Scratch.data(),static_cast<size_t>(Copied));
+    }
+
+    StreamSize Consume(std::istream& Stream, const StreamSize Size)
+    {
+        if( Size <= 0 ) {
+            return 0;
+        }
+
+        std::streambuf* Buf = Stream.rdbuf();
+        if( Stream.good() && GetAvailable(Buf) >= Size ) {
+            StreamBufferAccess::GetAdvance(Buf,Size);
+            return Size;
+        }
+        Stream.ignore(Size);
+        return Stream.gcount();
+    }
+
+    StreamSize ReadAt(std::istream& Stream, const StreamPos Position, void* Buffer, const StreamSize Size)
+    {
+        const StreamPos Invalid = StreamPos(StreamOff(-1));
+        std::streambuf* Buf = Stream.rdbuf();
+        if( Buf == nullptr || Size <= 0 ) {
+            return 0;
+        }
+
+        const StreamPos SavedPosition = Buf->pubseekoff(0,std::ios_base::cur,std::ios_base::in);
+        if( SavedPosition == Invalid || Buf->pubseekpos(Position,std::ios_base::in) == Invalid ) {
+            return 0;
+        }
+        const StreamSize BytesRead = Buf->sgetn(static_cast<Char8*>(Buffer),Size);
+        if( Buf->pubseekpos(SavedPosition,std::ios_base::in) == Invalid ) {
+            Stream.setstate(std::ios_base::badbit);
+            return 0;
+        }
+        return BytesRead;
+    }
+
+    StreamSize ReadV(std::istream& Stream, const StreamReadSegment* Segments, const size_t Count)
+    {
+        StreamSize Total = 0;
+        for( size_t CurrSeg = 0 ; CurrSeg < Count ; ++CurrSeg )
+        {
+            const StreamReadSegment& Segment = Segments[CurrSeg];
+            if( Segment.Size <= 0 ) {
+                continue;
+            }
+            // read handles the sentry, gcount, and exceptions thrown by the streambuf.
+            Stream.read(static_cast<Char8*>(Segment.Buffer),Segment.Size);
+            Total += Stream.gcount();
+            if( !Stream ) {
+                break;
+            }
+        }
+        return Total;
+    }
+
+    StreamSize WriteV(std::ostream& Stream, const StreamWriteSegment* Segments, const size_t Count)
+    {
+        const std::ostream::sentry Sentry(Stream);
+        if( !Sentry ) {
+            return 0;
+        }
+
+        std::streambuf* Buf = Stream.rdbuf();
+        StreamSize Total = 0;
+        Boole Incomplete = false;
+        try {
+            for( size_t CurrSeg = 0 ; CurrSeg < Count && !Incomplete ; ++CurrSeg )
+            {
+                const StreamWriteSegment& Segment = Segments[CurrSeg];
+                if( Segment.Size <= 0 ) {
+                    continue;
+                }
+                const StreamSize BytesWritten = Buf->sputn(static_cast<const Char8*>(Segment.Buffer),Segment.Size);
+                Total += BytesWritten;
+                Incomplete = ( BytesWritten < Segment.Size );
+            }
+        }catch(...) {
+            // Same as the standard unformatted functions, set the bad bit and only rethrow if asked to.
+            try {
+                Stream.setstate(std::ios_base::badbit);
+            }catch( std::ios_base::failure& ) {
+            }
+            if( Stream.exceptions() & std::ios_base::badbit ) {
+                throw;
+            }
+            return Total;
+        }
+        if( Incomplete ) {
+            Stream.setstate(std::ios_base::badbit);
+        }
+        return Total;
+    }
+}//StreamTools
+}//Mezzanine
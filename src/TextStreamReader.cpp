@@ -39,8 +39,72 @@
 */
 
 #include "TextStreamReader.h"
+#include "StreamTools.h"
 #include "MezzException.h"
 
+#include <algorithm>
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief The smallest amount to grow by when reading a Stream of unknown size.
+    constexpr size_t MinimumSlurpChunk = 64 * 1024;
+
+    /// @brief Reads from a Stream onto the end of a String.
+    /// @remarks When the standard library allows it the String is grown without zero filling the new space.
+    /// @param Dest The String to append to.
+    /// @param Input The Stream to read from.
+    /// @param Count The most characters to read.
+    void AppendFromStream(String& Dest, std::istream& Input, const size_t Count)
+    {
+        const size_t OldSize = Dest.size();
+    #if defined(__cpp_lib_string_resize_and_overwrite)
+        Dest.resize_and_overwrite(OldSize + Count,[&Input,OldSize,Count](Char8* Data, const size_t) {
+            Input.read(Data + OldSize,static_cast<StreamSize>(Count));
+            return OldSize + static_cast<size_t>( Input.gcount() );
+        });
+    #else
+        Dest.resize(OldSize + Count);
+        Input.read(Dest.data() + OldSize,static_cast<StreamSize>(Count));
+        Dest.resize( OldSize + static_cast<size_t>( Input.gcount() ) );
+    #endif
+    }
+    /// @brief Reads everything from the read position of a Stream to its end.
+    /// @param Input The Stream to read from.
+    /// @param SizeHint The number of characters expected to remain, or 0 if unknown.
+    /// @return Returns a String with the remaining contents of the Stream.
+    String ReadRemaining(std::istream& Input, const size_t SizeHint)
+    {
+        String ToReturn;
+        if( SizeHint > 0 ) {
+            ToReturn.reserve(SizeHint);
+            AppendFromStream(ToReturn,Input,SizeHint);
+        }
+        // Check for the end before growing, so an accurate hint never causes a reallocation.
+        while( Input.good() &&
+               !std::istream::traits_type::eq_int_type(Input.peek(),std::istream::traits_type::eof()) )
+        {
+            AppendFromStream(ToReturn,Input,std::max(ToReturn.size(),MinimumSlurpChunk));
+        }
+        return ToReturn;
+    }
+
+    /// @brief Checks if a character is whitespace in the C locale.
+    /// @param ToCheck The character to check.
+    /// @return Returns true if ToCheck is a space, tab, or line break character.
+    Boole IsWhitespace(const Char8 ToCheck) noexcept
+        { return ToCheck == ' ' || ( ToCheck >= '\t' && ToCheck <= '\r' ); }
+    /// @brief Checks if a character can be part of a number token.
+    /// @param ToCheck The character to check.
+    /// @return Returns true if ToCheck is an ASCII letter, digit, sign or decimal point.
+    Boole IsNumberCharacter(const Char8 ToCheck) noexcept
+    {
+        return ( ToCheck >= '0' && ToCheck <= '9' ) || ( ToCheck >= 'a' && ToCheck <= 'z' ) ||
+               ( ToCheck >= 'A' && ToCheck <= 'Z' ) || ToCheck == '+' || ToCheck == '-' || ToCheck == '.';
+    }
+}
+
 namespace Mezzanine
 {
     TextStreamReader::TextStreamReader(StdInputStreamPtr Input) :
@@ -61,13 +125,183 @@ namespace Mezzanine
         return ToReturn;
     }
 
+    StreamSize TextStreamReader::ScanUntil(const Char8 Delim, String* Collected)
+    {
+        std::istream& Input = *this->Stream;
+        if( Input.tie() != nullptr ) {
+            Input.tie()->flush();
+        }
+        std::streambuf* Buf = Input.rdbuf();
+        StreamSize Consumed = 0;
+        while( true )
+        {
+            if( StreamTools::GetAvailable(Buf) <= 0 &&
+                std::istream::traits_type::eq_int_type(Buf->sgetc(),std::istream::traits_type::eof()) )
+            {
+                Input.setstate(std::ios_base::eofbit);
+                return Consumed;
+            }
+            const StreamSize Available = StreamTools::GetAvailable(Buf);
+            if( Available <= 0 ) {
+                // Unbuffered streambufs only hand over a character at a time.
+                const Char8 Next = std::istream::traits_type::to_char_type( Buf->sbumpc() );
+                ++Consumed;
+                if( Next == Delim ) {
+                    return Consumed;
+                }
+                if( Collected != nullptr ) {
+                    Collected->push_back(Next);
+                }
+                continue;
+            }
+            const Char8* Start = StreamBufferAccess::GetCurrent(Buf);
+            const Char8* Found = StreamTools::FindCharacter(Start,Start + Available,Delim);
+            const StreamSize Length = Found - Start;
+            if( Collected != nullptr ) {
+                Collected->append(Start,static_cast<size_t>(Length));
+            }
+            if( Length < Available ) {
+                StreamBufferAccess::GetAdvance(Buf,Length + 1);
+                return Consumed + Length + 1;
+            }
+            StreamBufferAccess::GetAdvance(Buf,Length);
+            Consumed += Length;
+        }
+    }
+
+    StringView TextStreamReader::PeekNumberToken()
+    {
+        using TraitsType = std::istream::traits_type;
+        std::istream& Input = *this->Stream;
+        if( !Input.good() ) {
+            Input.setstate(std::ios_base::failbit);
+            return StringView();
+        }
+        if( Input.tie() != nullptr ) {
+            Input.tie()->flush();
+        }
+
+        std::streambuf* Buf = Input.rdbuf();
+        while( true )
+        {
+            const Char8* Current = StreamBufferAccess::GetCurrent(Buf);
+            const Char8* End = StreamBufferAccess::GetEnd(Buf);
+            const Char8* Skipped = Current;
+            while( Skipped < End && IsWhitespace(*Skipped) )
+                { ++Skipped; }
+            StreamBufferAccess::GetAdvance(Buf,Skipped - Current);
+            if( Skipped < End ) {
+                break;
+            }
+            const TraitsType::int_type Next = Buf->sgetc();
+            if( TraitsType::eq_int_type(Next,TraitsType::eof()) ) {
+                Input.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+                return StringView();
+            }
+            if( StreamTools::GetAvailable(Buf) <= 0 ) {
+                // Unbuffered streambufs only hand over a character at a time.
+                if( !IsWhitespace( TraitsType::to_char_type(Next) ) ) {
+                    break;
+                }
+                Buf->sbumpc();
+            }
+        }
+
+        const Char8* Start = StreamBufferAccess::GetCurrent(Buf);
+        const Char8* End = StreamBufferAccess::GetEnd(Buf);
+        const Char8* TokenEnd = Start;
+        while( TokenEnd < End && IsNumberCharacter(*TokenEnd) )
+            { ++TokenEnd; }
+        if( TokenEnd < End ) {
+            // The character after the token is buffered, so the whole token is.
+            return StringView(Start,static_cast<size_t>(TokenEnd - Start));
+        }
+
+        this->NumberScratch.clear();
+        while( true )
+        {
+            const TraitsType::int_type Next = Buf->sgetc();
+            if( TraitsType::eq_int_type(Next,TraitsType::eof()) ) {
+                Input.setstate(std::ios_base::eofbit);
+                break;
+            }
+            const StreamSize Available = StreamTools::GetAvailable(Buf);
+            if( Available <= 0 ) {
+                const Char8 Single = TraitsType::to_char_type(Next);
+                if( !IsNumberCharacter(Single) ) {
+                    break;
+                }
+                this->NumberScratch.push_back(Single);
+                Buf->sbumpc();
+                continue;
+            }
+            const Char8* Chunk = StreamBufferAccess::GetCurrent(Buf);
+            const Char8* ChunkEnd = Chunk;
+            while( ChunkEnd < Chunk + Available && IsNumberCharacter(*ChunkEnd) )
+                { ++ChunkEnd; }
+            this->NumberScratch.append(Chunk,static_cast<size_t>(ChunkEnd - Chunk));
+            StreamBufferAccess::GetAdvance(Buf,ChunkEnd - Chunk);
+            if( ChunkEnd < Chunk + Available ) {
+                break;
+            }
+        }
+        return this->NumberScratch;
+    }
+
+    Boole TextStreamReader::ConsumeNumberToken(const StringView Token, const size_t Parsed)
+    {
+        // Tokens that were gathered into the scratch buffer have already been consumed.
+        if( !Token.empty() && Token.data() != this->NumberScratch.data() ) {
+            StreamBufferAccess::GetAdvance(this->Stream->rdbuf(),static_cast<StreamSize>( Token.size() ));
+        }
+        if( Token.empty() || Parsed != Token.size() ) {
+            this->Stream->setstate(std::ios_base::failbit);
+            return false;
+        }
+        return true;
+    }
+
     String TextStreamReader::ReadLine(const Char8 Delim)
     {
-        String ToReturn;
-        std::getline( *(this->Stream.get()), ToReturn, Delim );
-        return ToReturn;
+        StringView Line;
+        if( !this->ReadLineView(Line,Delim) ) {
+            return String();
+        }
+        return String(Line);
+    }
+
+    Boole TextStreamReader::ReadLineView(StringView& Line, const Char8 Delim)
+    {
+        std::istream& Input = *this->Stream;
+        if( !Input.good() ) {
+            Input.setstate(std::ios_base::failbit);
+            return false;
+        }
+
+        std::streambuf* Buf = Input.rdbuf();
+        const Char8* Current = StreamBufferAccess::GetCurrent(Buf);
+        const Char8* End = StreamBufferAccess::GetEnd(Buf);
+        const Char8* Found = StreamTools::FindCharacter(Current,End,Delim);
+        if( Found != End && Input.tie() == nullptr ) {
+            // The common case, the whole line is buffered and can be returned in place.
+            const StreamSize Length = Found - Current;
+            Line = StringView(Current,static_cast<size_t>(Length));
+            StreamBufferAccess::GetAdvance(Buf,Length + 1);
+            return true;
+        }
+
+        this->LineScratch.clear();
+        if( this->ScanUntil(Delim,&this->LineScratch) == 0 ) {
+            Input.setstate(std::ios_base::failbit);
+            return false;
+        }
+        Line = this->LineScratch;
+        return true;
     }
 
+    TextStreamReader::LineRange TextStreamReader::ReadLines(const Char8 Delim)
+        { return LineRange(this,Delim); }
+
     Char8 TextStreamReader::ReadCharacter()
     {
         Char8 ToReturn = '\0';
@@ -81,30 +315,59 @@ namespace Mezzanine
         return this->Stream->gcount();
     }
 
-    String TextStreamReader::GetAsString()
+    StreamSize TextStreamReader::SkipUntil(const Char8 Delim)
     {
-        const StreamPos SavedReadPos = this->Stream->tellg();
-        if( SavedReadPos < 0 ) {
-            this->Stream->seekg(SavedReadPos); // Put the stream back how we found it
-            MEZZ_EXCEPTION(StreamReadErrorCode,
-                "Could not get current stream position while extracting all strean contents.")
+        if( !this->Stream->good() ) {
+            this->Stream->setstate(std::ios_base::failbit);
+            return 0;
         }
+        return this->ScanUntil(Delim,nullptr);
+    }
 
-        this->Stream->seekg(0,std::ios::end);
-        const StreamPos ReturnSizeRaw = this->Stream->tellg();
-        if( ReturnSizeRaw < 0 ) {
-            this->Stream->seekg(SavedReadPos); // Put the stream back how we found it
+    String TextStreamReader::GetAsString()
+    {
+        std::istream& Input = *this->Stream;
+        if( Input.fail() ) {
             MEZZ_EXCEPTION(StreamReadErrorCode,
-                "Nothing to extract while extracting all strean contents.")
+                "Stream is not valid while extracting all stream contents.")
         }
 
-        const String::size_type ReturnSize = static_cast<String::size_type>(ReturnSizeRaw);
+        // Ask the streambuf directly, tellg fails on a Stream that has only hit the end.
+        const std::ios_base::iostate SavedState = Input.rdstate();
+        const StreamPos SavedReadPos = Input.rdbuf()->pubseekoff(0,std::ios_base::cur,std::ios_base::in);
+        if( SavedReadPos == StreamPos(StreamOff(-1)) ) {
+            // Streams that can't seek can only give what remains.
+            String ToReturn = ReadRemaining(Input,0);
+            if( Input.bad() ) {
+                MEZZ_EXCEPTION(StreamReadErrorCode,
+                    "Could not read remaining stream contents while extracting all stream contents.")
+            }
+            return ToReturn;
+        }
 
-        String ToReturn(ReturnSize,0);
-        this->Stream->seekg(0,std::ios::beg);
-        this->Stream->read(&ToReturn[0],static_cast<StreamSize>(ReturnSizeRaw));
+        Input.seekg(0,std::ios::beg);
+        if( Input.fail() ) {
+            Input.clear();
+            Input.seekg(SavedReadPos); // Put the stream back how we found it
+            Input.clear(SavedState);
+            MEZZ_EXCEPTION(StreamReadErrorCode,
+                "Could not seek to the start of the stream while extracting all stream contents.")
+        }
+        // Prefer the size the Stream knows, then whatever the streambuf can report without a seek.
+        StreamSize SizeHint = Input.rdbuf()->in_avail();
+        const StreamBase* Base = dynamic_cast<const StreamBase*>(&Input);
+        if( Base != nullptr && Base->CanSeek() ) {
+            SizeHint = Base->GetSize();
+        }
 
-        this->Stream->seekg(SavedReadPos); // Put the stream back how we found it
+        String ToReturn = ReadRemaining(Input,static_cast<size_t>( std::max(SizeHint,StreamSize(0)) ));
+        if( Input.bad() ) {
+            MEZZ_EXCEPTION(StreamReadErrorCode,
+                "Could not read stream contents while extracting all stream contents.")
+        }
+        Input.clear();
+        Input.seekg(SavedReadPos); // Put the stream back how we found it
+        Input.clear(SavedState);
         return ToReturn;
     }
 
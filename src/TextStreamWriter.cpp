@@ -39,14 +39,80 @@
 */
 
 #include "TextStreamWriter.h"
+#include "StreamTools.h"
 #include "MezzException.h"
 
+#include <cstring>
+
 namespace Mezzanine
 {
-    TextStreamWriter::TextStreamWriter(StdOutputStreamPtr Output) :
-        Stream(Output)
+    TextStreamWriter::TextStreamWriter(StdOutputStreamPtr Output, const size_t BufferSize) :
+        Stream(Output),
+        Buffer(BufferSize)
         {  }
 
+    TextStreamWriter::~TextStreamWriter()
+        { this->WriteBuffer(); }
+
+    Char8* TextStreamWriter::ReserveSpace(const size_t Size)
+    {
+        if( !this->Buffer.empty() ) {
+            if( this->Buffer.size() < Size ) {
+                return nullptr;
+            }
+            if( this->Buffer.size() - this->Used < Size ) {
+                this->WriteBuffer();
+            }
+            return this->Buffer.data() + this->Used;
+        }
+
+        // Same conditions as StreamTools::TryWriteBuffered, so the result is no different from a call to write.
+        std::ostream& Output = *this->Stream;
+        std::streambuf* Buf = Output.rdbuf();
+        if( !Output.good() || Output.tie() != nullptr || ( Output.flags() & std::ios_base::unitbuf ) ||
+            StreamTools::GetWritable(Buf) < static_cast<StreamSize>(Size) )
+        {
+            return nullptr;
+        }
+        return StreamBufferAccess::PutCurrent(Buf);
+    }
+
+    void TextStreamWriter::CommitSpace(const size_t Size)
+    {
+        if( !this->Buffer.empty() ) {
+            this->Used += Size;
+        }else{
+            StreamBufferAccess::PutAdvance(this->Stream->rdbuf(),static_cast<StreamSize>(Size));
+        }
+    }
+
+    Boole TextStreamWriter::WriteData(const Char8* Data, const size_t Size)
+    {
+        if( Size < this->Buffer.size() ) {
+            if( this->Buffer.size() - this->Used < Size ) {
+                this->WriteBuffer();
+            }
+            std::memcpy(this->Buffer.data() + this->Used,Data,Size);
+            this->Used += Size;
+            return this->Stream->good();
+        }
+
+        // Too big to be worth buffering, but anything already buffered has to go first to keep the order.
+        this->WriteBuffer();
+        if( !StreamTools::TryWriteBuffered(*this->Stream,Data,static_cast<StreamSize>(Size)) ) {
+            this->Stream->write(Data,static_cast<StreamSize>(Size));
+        }
+        return this->Stream->good();
+    }
+
+    void TextStreamWriter::WriteBuffer()
+    {
+        if( this->Used > 0 ) {
+            this->Stream->write(this->Buffer.data(),static_cast<StreamSize>(this->Used));
+            this->Used = 0;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     // Writing
 
@@ -55,14 +121,24 @@ namespace Mezzanine
         if( static_cast<SizeType>(std::numeric_limits<StreamSize>::max()) < ToWrite.size() ) {
             MEZZ_EXCEPTION(StreamOverflowCode, "String size larger than StreamSize max value.")
         }
-
-        this->Stream->write(ToWrite.data(),static_cast<StreamSize>(ToWrite.size()));
-        return this->Stream->good();
+        return this->WriteData(ToWrite.data(),ToWrite.size());
     }
 
     Boole TextStreamWriter::Write(const Char8 ToWrite)
     {
+        if( Char8* Space = this->ReserveSpace(1) ) {
+            *Space = ToWrite;
+            this->CommitSpace(1);
+            return this->Stream->good();
+        }
         this->Stream->write(&ToWrite,sizeof(Char8));
         return this->Stream->good();
     }
+
+    Boole TextStreamWriter::Flush()
+    {
+        this->WriteBuffer();
+        this->Stream->flush();
+        return this->Stream->good();
+    }
 }//Mezzanine
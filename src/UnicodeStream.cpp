@@ -0,0 +1,275 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#include "UnicodeStream.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    /// @brief The smallest buffer that can hold a cut off character along with more data.
+    constexpr size_t MinimumBufferSize = 16;
+}
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // Utf8ValidatingBuffer Methods
+
+    Utf8ValidatingBuffer::Utf8ValidatingBuffer(std::streambuf* ToRead, const size_t BufSize) :
+        Source(ToRead),
+        Buffer( BufferPool::Acquire( std::max(BufSize,MinimumBufferSize) ) ),
+        BufferSize( std::max(BufSize,MinimumBufferSize) )
+        {  }
+
+    Boole Utf8ValidatingBuffer::IsValid() const noexcept
+        { return this->Valid; }
+
+    StreamSize Utf8ValidatingBuffer::GetValidatedCount() const noexcept
+        { return this->Validated; }
+
+    Utf8ValidatingBuffer::int_type Utf8ValidatingBuffer::underflow()
+    {
+        if( this->gptr() < this->egptr() ) {
+            return traits_type::to_int_type(*this->gptr());
+        }
+        if( !this->Valid ) {
+            return traits_type::eof();
+        }
+
+        Char8* Data = this->Buffer.get();
+        std::memmove(Data,Data + this->HeldStart,this->HeldCount);
+        size_t Filled = this->HeldCount;
+        this->HeldStart = 0;
+        this->HeldCount = 0;
+        while( true )
+        {
+            const StreamSize Read = this->Source->sgetn(Data + Filled,static_cast<StreamSize>(this->BufferSize - Filled));
+            if( Read <= 0 ) {
+                // Held bytes at the end of the source are a character that was cut off.
+                this->Valid = ( Filled == 0 );
+                this->setg(Data,Data,Data);
+                return traits_type::eof();
+            }
+            Filled += static_cast<size_t>(Read);
+
+            const Char8* ValidEnd = UnicodeTools::ValidateUtf8(Data,Data + Filled);
+            const size_t Checked = static_cast<size_t>(ValidEnd - Data);
+            if( Checked < Filled ) {
+                if( UnicodeTools::IsIncompleteUtf8(ValidEnd,Data + Filled) ) {
+                    this->HeldStart = Checked;
+                    this->HeldCount = Filled - Checked;
+                }else{
+                    this->Valid = false;
+                }
+            }else{
+                // A short read may have held bytes on an earlier pass that this pass has now completed.
+                this->HeldStart = 0;
+                this->HeldCount = 0;
+            }
+            this->Validated += static_cast<StreamSize>(Checked);
+            if( Checked > 0 ) {
+                this->setg(Data,Data,Data + Checked);
+                return traits_type::to_int_type(*Data);
+            }
+            if( !this->Valid ) {
+                this->setg(Data,Data,Data);
+                return traits_type::eof();
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Utf16InputBuffer Methods
+
+    Utf16InputBuffer::Utf16InputBuffer(std::streambuf* ToRead, const ByteOrder SourceOrder, const size_t BufSize) :
+        Source(ToRead),
+        RawBuffer( BufferPool::Acquire( std::max(BufSize,MinimumBufferSize) ) ),
+        TextBuffer( BufferPool::Acquire( UnicodeTools::GetUtf8Capacity( std::max(BufSize,MinimumBufferSize) ) ) ),
+        BufferSize( std::max(BufSize,MinimumBufferSize) ),
+        Order(SourceOrder)
+        {  }
+
+    ByteOrder Utf16InputBuffer::GetByteOrder() const noexcept
+        { return this->Order; }
+
+    Boole Utf16InputBuffer::IsValid() const noexcept
+        { return this->Valid; }
+
+    Utf16InputBuffer::int_type Utf16InputBuffer::underflow()
+    {
+        if( this->gptr() < this->egptr() ) {
+            return traits_type::to_int_type(*this->gptr());
+        }
+        if( !this->Valid ) {
+            return traits_type::eof();
+        }
+
+        Char8* Raw = this->RawBuffer.get();
+        Char8* Text = this->TextBuffer.get();
+        std::memmove(Raw,Raw + this->HeldStart,this->HeldCount);
+        size_t Filled = this->HeldCount;
+        this->HeldStart = 0;
+        this->HeldCount = 0;
+        while( true )
+        {
+            const StreamSize Read = this->Source->sgetn(Raw + Filled,static_cast<StreamSize>(this->BufferSize - Filled));
+            if( Read <= 0 ) {
+                this->Valid = ( Filled == 0 );
+                this->setg(Text,Text,Text);
+                return traits_type::eof();
+            }
+            Filled += static_cast<size_t>(Read);
+
+            size_t Start = 0;
+            if( this->CheckMark ) {
+                if( Filled < 2 ) {
+                    continue;
+                }
+                this->CheckMark = false;
+                const UInt8 First = static_cast<UInt8>(Raw[0]);
+                const UInt8 Second = static_cast<UInt8>(Raw[1]);
+                if( First == 0xFF && Second == 0xFE ) {
+                    this->Order = ByteOrder::Little;
+                    Start = 2;
+                }else if( First == 0xFE && Second == 0xFF ) {
+                    this->Order = ByteOrder::Big;
+                    Start = 2;
+                }
+            }
+
+            const UnicodeTools::TranscodeResult Result = UnicodeTools::Utf16ToUtf8(Raw + Start,Filled - Start,this->Order,Text);
+            if( Result.Valid ) {
+                this->HeldStart = Start + Result.Read;
+                this->HeldCount = Filled - this->HeldStart;
+            }else{
+                this->Valid = false;
+            }
+            if( Result.Written > 0 ) {
+                this->setg(Text,Text,Text + Result.Written);
+                return traits_type::to_int_type(*Text);
+            }
+            if( !this->Valid ) {
+                this->setg(Text,Text,Text);
+                return traits_type::eof();
+            }
+            std::memmove(Raw,Raw + this->HeldStart,this->HeldCount);
+            Filled = this->HeldCount;
+            this->HeldStart = 0;
+            this->HeldCount = 0;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Utf16OutputBuffer Methods
+
+    Utf16OutputBuffer::Utf16OutputBuffer(std::streambuf* ToWrite,
+                                         const ByteOrder DestOrder,
+                                         const Boole WriteMark,
+                                         const size_t BufSize) :
+        Destination(ToWrite),
+        TextBuffer( BufferPool::Acquire( std::max(BufSize,MinimumBufferSize) ) ),
+        RawBuffer( BufferPool::Acquire( UnicodeTools::GetUtf16Capacity( std::max(BufSize,MinimumBufferSize) ) + 2 ) ),
+        BufferSize( std::max(BufSize,MinimumBufferSize) ),
+        Order(DestOrder),
+        MarkPending(WriteMark)
+    {
+        Char8* Text = this->TextBuffer.get();
+        this->setp(Text,Text + this->BufferSize);
+    }
+
+    Utf16OutputBuffer::~Utf16OutputBuffer()
+        { this->FlushText(); }
+
+    Boole Utf16OutputBuffer::FlushText()
+    {
+        if( !this->Valid ) {
+            return false;
+        }
+
+        Char8* Text = this->TextBuffer.get();
+        Char8* Raw = this->RawBuffer.get();
+        const size_t Pending = static_cast<size_t>(this->pptr() - this->pbase());
+        size_t Offset = 0;
+        if( this->MarkPending ) {
+            Raw[0] = static_cast<Char8>( this->Order == ByteOrder::Little ? 0xFF : 0xFE );
+            Raw[1] = static_cast<Char8>( this->Order == ByteOrder::Little ? 0xFE : 0xFF );
+            Offset = 2;
+            this->MarkPending = false;
+        }
+        const UnicodeTools::TranscodeResult Result = UnicodeTools::Utf8ToUtf16(Text,Pending,this->Order,Raw + Offset);
+        const StreamSize ToWrite = static_cast<StreamSize>(Offset + Result.Written);
+        const Boole Written = ( ToWrite == 0 || this->Destination->sputn(Raw,ToWrite) == ToWrite );
+
+        // Keep a cut off character at the front of the put area for the next conversion.
+        const size_t Held = ( Result.Valid ? Pending - Result.Read : 0 );
+        std::memmove(Text,Text + Result.Read,Held);
+        this->setp(Text,Text + this->BufferSize);
+        this->pbump(static_cast<int>(Held));
+        this->Valid = Result.Valid;
+        return ( Result.Valid && Written );
+    }
+
+    ByteOrder Utf16OutputBuffer::GetByteOrder() const noexcept
+        { return this->Order; }
+
+    Boole Utf16OutputBuffer::IsValid() const noexcept
+        { return this->Valid; }
+
+    Utf16OutputBuffer::int_type Utf16OutputBuffer::overflow(int_type Character)
+    {
+        if( !this->FlushText() ) {
+            return traits_type::eof();
+        }
+        if( !traits_type::eq_int_type(Character,traits_type::eof()) ) {
+            *this->pptr() = traits_type::to_char_type(Character);
+            this->pbump(1);
+        }
+        return traits_type::not_eof(Character);
+    }
+
+    int Utf16OutputBuffer::sync()
+    {
+        if( !this->FlushText() ) {
+            return -1;
+        }
+        return ( this->Destination->pubsync() == 0 ? 0 : -1 );
+    }
+}//Mezzanine
@@ -0,0 +1,409 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#include "UnicodeTools.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <immintrin.h>
+    #define MEZZ_UNICODE_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define MEZZ_UNICODE_NEON
+#endif
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief The number of characters converted per vector step.
+    constexpr size_t VectorWidth = 16;
+
+    /// @brief Decodes a single UTF-8 sequence.
+    /// @param Current The first byte of the sequence.
+    /// @param End One past the last readable byte.
+    /// @param CodePoint Set to the decoded code point if the sequence is valid.
+    /// @param Truncated Set to true if the sequence is valid so far but cut off by End.
+    /// @return Returns the length of the sequence, or 0 if it is invalid or cut off.
+    size_t DecodeSequence(const UInt8* Current, const UInt8* End, UInt32& CodePoint, Boole& Truncated) noexcept
+    {
+        Truncated = false;
+        const UInt8 Lead = Current[0];
+        if( Lead < 0x80 ) {
+            CodePoint = Lead;
+            return 1;
+        }
+
+        // The second byte has a narrower range for leads that could otherwise make overlong forms,
+        // surrogates or code points past U+10FFFF.
+        size_t Length = 0;
+        UInt8 SecondMin = 0x80;
+        UInt8 SecondMax = 0xBF;
+        if( Lead >= 0xC2 && Lead <= 0xDF ) {
+            Length = 2;
+            CodePoint = Lead & 0x1Fu;
+        }else if( Lead >= 0xE0 && Lead <= 0xEF ) {
+            Length = 3;
+            CodePoint = Lead & 0x0Fu;
+            SecondMin = ( Lead == 0xE0 ? 0xA0 : 0x80 );
+            SecondMax = ( Lead == 0xED ? 0x9F : 0xBF );
+        }else if( Lead >= 0xF0 && Lead <= 0xF4 ) {
+            Length = 4;
+            CodePoint = Lead & 0x07u;
+            SecondMin = ( Lead == 0xF0 ? 0x90 : 0x80 );
+            SecondMax = ( Lead == 0xF4 ? 0x8F : 0xBF );
+        }else{
+            return 0;
+        }
+
+        const size_t Available = static_cast<size_t>(End - Current);
+        for( size_t Index = 1 ; Index < Length ; ++Index )
+        {
+            if( Index >= Available ) {
+                Truncated = true;
+                return 0;
+            }
+            const UInt8 Next = Current[Index];
+            const UInt8 Min = ( Index == 1 ? SecondMin : 0x80 );
+            const UInt8 Max = ( Index == 1 ? SecondMax : 0xBF );
+            if( Next < Min || Next > Max ) {
+                return 0;
+            }
+            CodePoint = ( CodePoint << 6 ) | ( Next & 0x3Fu );
+        }
+        return Length;
+    }
+
+    /// @brief Finds the end of a run of ASCII characters.
+    /// @param Current The start of the text to check.
+    /// @param End One past the end of the text to check.
+    /// @return Returns the first byte that is not ASCII, or End.
+    const UInt8* SkipAscii(const UInt8* Current, const UInt8* End) noexcept
+    {
+    #if defined(__AVX2__)
+        while( End - Current >= 32 )
+        {
+            const __m256i Chunk = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(Current) );
+            if( _mm256_movemask_epi8(Chunk) != 0 ) {
+                break;
+            }
+            Current += 32;
+        }
+    #endif
+    #if defined(MEZZ_UNICODE_SSE2)
+        while( End - Current >= 16 )
+        {
+            const __m128i Chunk = _mm_loadu_si128( reinterpret_cast<const __m128i*>(Current) );
+            if( _mm_movemask_epi8(Chunk) != 0 ) {
+                break;
+            }
+            Current += 16;
+        }
+    #elif defined(MEZZ_UNICODE_NEON)
+        while( End - Current >= 16 )
+        {
+            if( vmaxvq_u8( vld1q_u8(Current) ) >= 0x80 ) {
+                break;
+            }
+            Current += 16;
+        }
+    #endif
+        while( Current < End && *Current < 0x80 )
+            { ++Current; }
+        return Current;
+    }
+
+    /// @brief Reads a UTF-16 code unit.
+    /// @param Source The bytes of the code unit.
+    /// @param Order The byte order of the code unit.
+    /// @return Returns the code unit.
+    UInt32 LoadUnit(const UInt8* Source, const ByteOrder Order) noexcept
+    {
+        if( Order == ByteOrder::Little ) {
+            return static_cast<UInt32>( Source[0] | ( Source[1] << 8 ) );
+        }
+        return static_cast<UInt32>( ( Source[0] << 8 ) | Source[1] );
+    }
+
+    /// @brief Writes a UTF-16 code unit.
+    /// @param Dest The buffer to write the code unit to.
+    /// @param Unit The code unit to write.
+    /// @param Order The byte order to write the code unit in.
+    void StoreUnit(UInt8* Dest, const UInt32 Unit, const ByteOrder Order) noexcept
+    {
+        const UInt8 Low = static_cast<UInt8>( Unit & 0xFFu );
+        const UInt8 High = static_cast<UInt8>( Unit >> 8 );
+        Dest[0] = ( Order == ByteOrder::Little ? Low : High );
+        Dest[1] = ( Order == ByteOrder::Little ? High : Low );
+    }
+
+    /// @brief Converts leading blocks of ASCII from UTF-16 to UTF-8.
+    /// @param Source The UTF-16 to convert.
+    /// @param Units The number of code units available.
+    /// @param Swap Whether the UTF-16 is in the opposite of the native byte order.
+    /// @param Dest The buffer to write UTF-8 to.
+    /// @return Returns the number of code units converted, always a multiple of the vector width.
+    size_t ConvertAsciiFromUtf16(const UInt8* Source, const size_t Units, const Boole Swap, UInt8* Dest) noexcept
+    {
+        size_t Converted = 0;
+    #if defined(MEZZ_UNICODE_SSE2)
+        const __m128i NonAscii = _mm_set1_epi16( static_cast<short>(0xFF80) );
+        for( ; Units - Converted >= VectorWidth ; Converted += VectorWidth )
+        {
+            __m128i Low = _mm_loadu_si128( reinterpret_cast<const __m128i*>( Source + Converted * 2 ) );
+            __m128i High = _mm_loadu_si128( reinterpret_cast<const __m128i*>( Source + Converted * 2 + 16 ) );
+            if( Swap ) {
+                Low = _mm_or_si128(_mm_slli_epi16(Low,8),_mm_srli_epi16(Low,8));
+                High = _mm_or_si128(_mm_slli_epi16(High,8),_mm_srli_epi16(High,8));
+            }
+            const __m128i Outside = _mm_and_si128(_mm_or_si128(Low,High),NonAscii);
+            if( _mm_movemask_epi8( _mm_cmpeq_epi16(Outside,_mm_setzero_si128()) ) != 0xFFFF ) {
+                break;
+            }
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( Dest + Converted ), _mm_packus_epi16(Low,High) );
+        }
+    #elif defined(MEZZ_UNICODE_NEON)
+        for( ; Units - Converted >= VectorWidth ; Converted += VectorWidth )
+        {
+            uint8x16_t LowBytes = vld1q_u8( Source + Converted * 2 );
+            uint8x16_t HighBytes = vld1q_u8( Source + Converted * 2 + 16 );
+            if( Swap ) {
+                LowBytes = vrev16q_u8(LowBytes);
+                HighBytes = vrev16q_u8(HighBytes);
+            }
+            const uint16x8_t Low = vreinterpretq_u16_u8(LowBytes);
+            const uint16x8_t High = vreinterpretq_u16_u8(HighBytes);
+            if( vmaxvq_u16( vorrq_u16(Low,High) ) >= 0x80 ) {
+                break;
+            }
+            vst1q_u8( Dest + Converted, vcombine_u8( vmovn_u16(Low), vmovn_u16(High) ) );
+        }
+    #else
+        (void)Source;
+        (void)Units;
+        (void)Swap;
+        (void)Dest;
+    #endif
+        return Converted;
+    }
+
+    /// @brief Converts leading blocks of ASCII from UTF-8 to UTF-16.
+    /// @param Source The UTF-8 to convert.
+    /// @param Length The number of bytes available.
+    /// @param Swap Whether to write the UTF-16 in the opposite of the native byte order.
+    /// @param Dest The buffer to write UTF-16 to.
+    /// @return Returns the number of bytes converted, always a multiple of the vector width.
+    size_t ConvertAsciiToUtf16(const UInt8* Source, const size_t Length, const Boole Swap, UInt8* Dest) noexcept
+    {
+        size_t Converted = 0;
+    #if defined(MEZZ_UNICODE_SSE2)
+        const __m128i Zero = _mm_setzero_si128();
+        for( ; Length - Converted >= VectorWidth ; Converted += VectorWidth )
+        {
+            const __m128i Chunk = _mm_loadu_si128( reinterpret_cast<const __m128i*>( Source + Converted ) );
+            if( _mm_movemask_epi8(Chunk) != 0 ) {
+                break;
+            }
+            // Widening with zeros gives the little endian layout, widening into the other half gives big endian.
+            const __m128i Low = ( Swap ? _mm_unpacklo_epi8(Zero,Chunk) : _mm_unpacklo_epi8(Chunk,Zero) );
+            const __m128i High = ( Swap ? _mm_unpackhi_epi8(Zero,Chunk) : _mm_unpackhi_epi8(Chunk,Zero) );
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( Dest + Converted * 2 ), Low );
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( Dest + Converted * 2 + 16 ), High );
+        }
+    #elif defined(MEZZ_UNICODE_NEON)
+        for( ; Length - Converted >= VectorWidth ; Converted += VectorWidth )
+        {
+            const uint8x16_t Chunk = vld1q_u8( Source + Converted );
+            if( vmaxvq_u8(Chunk) >= 0x80 ) {
+                break;
+            }
+            uint8x16_t Low = vreinterpretq_u8_u16( vmovl_u8( vget_low_u8(Chunk) ) );
+            uint8x16_t High = vreinterpretq_u8_u16( vmovl_u8( vget_high_u8(Chunk) ) );
+            if( Swap ) {
+                Low = vrev16q_u8(Low);
+                High = vrev16q_u8(High);
+            }
+            vst1q_u8( Dest + Converted * 2, Low );
+            vst1q_u8( Dest + Converted * 2 + 16, High );
+        }
+    #else
+        (void)Source;
+        (void)Length;
+        (void)Swap;
+        (void)Dest;
+    #endif
+        return Converted;
+    }
+}
+
+namespace Mezzanine
+{
+namespace UnicodeTools
+{
+    const Char8* ValidateUtf8(const Char8* Begin, const Char8* End) noexcept
+    {
+        const UInt8* Current = reinterpret_cast<const UInt8*>(Begin);
+        const UInt8* Last = reinterpret_cast<const UInt8*>(End);
+        while( Current < Last )
+        {
+            Current = SkipAscii(Current,Last);
+            // Stay on the scalar path until the next ASCII character, so text in other scripts does not
+            // bounce between the vector and scalar code on every character.
+            while( Current < Last && *Current >= 0x80 )
+            {
+                UInt32 CodePoint = 0;
+                Boole Truncated = false;
+                const size_t Length = DecodeSequence(Current,Last,CodePoint,Truncated);
+                if( Length == 0 ) {
+                    return reinterpret_cast<const Char8*>(Current);
+                }
+                Current += Length;
+            }
+        }
+        return End;
+    }
+
+    Boole IsIncompleteUtf8(const Char8* Begin, const Char8* End) noexcept
+    {
+        if( Begin >= End ) {
+            return false;
+        }
+        UInt32 CodePoint = 0;
+        Boole Truncated = false;
+        DecodeSequence(reinterpret_cast<const UInt8*>(Begin),reinterpret_cast<const UInt8*>(End),CodePoint,Truncated);
+        return Truncated;
+    }
+
+    TranscodeResult Utf16ToUtf8(const Char8* Source, const size_t Length, const ByteOrder Order, Char8* Dest) noexcept
+    {
+        const UInt8* In = reinterpret_cast<const UInt8*>(Source);
+        UInt8* Out = reinterpret_cast<UInt8*>(Dest);
+        const Boole Swap = ( Order != ByteOrder::Native );
+        const size_t UnitBytes = Length & ~size_t(1);
+        TranscodeResult Result;
+        while( Result.Read < UnitBytes )
+        {
+            const size_t Ascii = ConvertAsciiFromUtf16(In + Result.Read,( UnitBytes - Result.Read ) / 2,Swap,Out + Result.Written);
+            Result.Read += Ascii * 2;
+            Result.Written += Ascii;
+
+            const size_t BlockEnd = std::min(UnitBytes,Result.Read + VectorWidth * 2);
+            while( Result.Read < BlockEnd )
+            {
+                const UInt32 Unit = LoadUnit(In + Result.Read,Order);
+                UInt8* Written = Out + Result.Written;
+                if( Unit < 0x80 ) {
+                    Written[0] = static_cast<UInt8>(Unit);
+                    Result.Written += 1;
+                }else if( Unit < 0x800 ) {
+                    Written[0] = static_cast<UInt8>( 0xC0u | ( Unit >> 6 ) );
+                    Written[1] = static_cast<UInt8>( 0x80u | ( Unit & 0x3Fu ) );
+                    Result.Written += 2;
+                }else if( Unit >= 0xD800 && Unit <= 0xDBFF ) {
+                    if( Result.Read + 4 > UnitBytes ) {
+                        // The pair is cut off, leave the high surrogate for the next call.
+                        return Result;
+                    }
+                    const UInt32 Trail = LoadUnit(In + Result.Read + 2,Order);
+                    if( Trail < 0xDC00 || Trail > 0xDFFF ) {
+                        Result.Valid = false;
+                        return Result;
+                    }
+                    const UInt32 CodePoint = 0x10000u + ( ( Unit - 0xD800u ) << 10 ) + ( Trail - 0xDC00u );
+                    Written[0] = static_cast<UInt8>( 0xF0u | ( CodePoint >> 18 ) );
+                    Written[1] = static_cast<UInt8>( 0x80u | ( ( CodePoint >> 12 ) & 0x3Fu ) );
+                    Written[2] = static_cast<UInt8>( 0x80u | ( ( CodePoint >> 6 ) & 0x3Fu ) );
+                    Written[3] = static_cast<UInt8>( 0x80u | ( CodePoint & 0x3Fu ) );
+                    Result.Written += 4;
+                    Result.Read += 2;
+                }else if( Unit >= 0xDC00 && Unit <= 0xDFFF ) {
+                    Result.Valid = false;
+                    return Result;
+                }else{
+                    Written[0] = static_cast<UInt8>( 0xE0u | ( Unit >> 12 ) );
+                    Written[1] = static_cast<UInt8>( 0x80u | ( ( Unit >> 6 ) & 0x3Fu ) );
+                    Written[2] = static_cast<UInt8>( 0x80u | ( Unit & 0x3Fu ) );
+                    Result.Written += 3;
+                }
+                Result.Read += 2;
+            }
+        }
+        return Result;
+    }
+
+    TranscodeResult Utf8ToUtf16(const Char8* Source, const size_t Length, const ByteOrder Order, Char8* Dest) noexcept
+    {
+        const UInt8* In = reinterpret_cast<const UInt8*>(Source);
+        const UInt8* End = In + Length;
+        UInt8* Out = reinterpret_cast<UInt8*>(Dest);
+        const Boole Swap = ( Order != ByteOrder::Native );
+        TranscodeResult Result;
+        while( Result.Read < Length )
+        {
+            const size_t Ascii = ConvertAsciiToUtf16(In + Result.Read,Length - Result.Read,Swap,Out + Result.Written);
+            Result.Read += Ascii;
+            Result.Written += Ascii * 2;
+
+            const size_t BlockEnd = std::min(Length,Result.Read + VectorWidth);
+            while( Result.Read < BlockEnd )
+            {
+                UInt32 CodePoint = 0;
+                Boole Truncated = false;
+                const size_t SequenceLength = DecodeSequence(In + Result.Read,End,CodePoint,Truncated);
+                if( SequenceLength == 0 ) {
+                    Result.Valid = Truncated;
+                    return Result;
+                }
+                if( CodePoint >= 0x10000 ) {
+                    const UInt32 Offset = CodePoint - 0x10000u;
+                    StoreUnit(Out + Result.Written,0xD800u + ( Offset >> 10 ),Order);
+                    StoreUnit(Out + Result.Written + 2,0xDC00u + ( Offset & 0x3FFu ),Order);
+                    Result.Written += 4;
+                }else{
+                    StoreUnit(Out + Result.Written,CodePoint,Order);
+                    Result.Written += 2;
+                }
+                Result.Read += SequenceLength;
+            }
+        }
+        return Result;
+    }
+}//UnicodeTools
+}//Mezzanine
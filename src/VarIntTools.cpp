@@ -0,0 +1,203 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "VarIntTools.h"
+
+#include <algorithm>
+
+#if defined(__SSSE3__)
+    #include <immintrin.h>
+    #define MEZZ_STREAMVBYTE_SIMD
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define MEZZ_STREAMVBYTE_SIMD
+#endif
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief Lookup tables for decoding four Stream VByte values from a single length code byte.
+    struct StreamVByteTables
+    {
+        /// @brief The number of value bytes described by each length code byte.
+        UInt8 Lengths[256];
+        /// @brief Byte shuffles that expand the value bytes into four 32-bit values, for each length code byte.
+        /// @remarks Indexes of 0x80 produce a zero byte with both SSSE3 and NEON table lookups.
+        alignas(16) UInt8 Shuffles[256][16];
+
+        /// @brief Class constructor.
+        StreamVByteTables()
+        {
+            for( size_t Code = 0 ; Code < 256 ; ++Code )
+            {
+                UInt8 Offset = 0;
+                for( size_t Value = 0 ; Value < 4 ; ++Value )
+                {
+                    const UInt8 Length = static_cast<UInt8>( ( ( Code >> ( Value * 2 ) ) & 3 ) + 1 );
+                    for( UInt8 Byte = 0 ; Byte < 4 ; ++Byte )
+                    {
+                        this->Shuffles[Code][Value * 4 + Byte] = ( Byte < Length ? static_cast<UInt8>(Offset + Byte) : 0x80 );
+                    }
+                    Offset = static_cast<UInt8>(Offset + Length);
+                }
+                this->Lengths[Code] = Offset;
+            }
+        }
+    };//StreamVByteTables
+
+    /// @brief Gets the Stream VByte decoding tables.
+    /// @return Returns a reference to the tables.
+    const StreamVByteTables& GetStreamVByteTables()
+    {
+        static const StreamVByteTables Tables;
+        return Tables;
+    }
+
+    /// @brief Gets the 2-bit length code for a single value.
+    /// @param Index The index of the value in the array.
+    /// @param Control The length codes of the array.
+    /// @return Returns the number of bytes the value takes, minus one.
+    size_t GetLengthCode(const size_t Index, const UInt8* Control) noexcept
+        { return ( Control[Index / 4] >> ( ( Index % 4 ) * 2 ) ) & 3; }
+}
+
+namespace Mezzanine
+{
+    namespace VarIntTools
+    {
+        size_t EncodeVarInt(UInt64 Value, UInt8* Out) noexcept
+        {
+            size_t Written = 0;
+            while( Value >= 0x80 )
+            {
+                Out[Written++] = static_cast<UInt8>( ( Value & 0x7F ) | 0x80 );
+                Value >>= 7;
+            }
+            Out[Written++] = static_cast<UInt8>(Value);
+            return Written;
+        }
+
+        size_t DecodeVarInt(const UInt8* In, const size_t Available, UInt64& Value) noexcept
+        {
+            UInt64 Result = 0;
+            const size_t Limit = std::min(Available,MaxVarIntSize);
+            for( size_t Index = 0 ; Index < Limit ; ++Index )
+            {
+                const UInt8 Byte = In[Index];
+                if( Index == MaxVarIntSize - 1 && Byte > 1 ) {
+                    // Only one bit of a 64-bit value is left for the last byte.
+                    return 0;
+                }
+                Result |= UInt64( Byte & 0x7F ) << ( Index * 7 );
+                if( ( Byte & 0x80 ) == 0 ) {
+                    Value = Result;
+                    return Index + 1;
+                }
+            }
+            return 0;
+        }
+
+        size_t StreamVByteDataSize(const UInt8* Control, const size_t Count) noexcept
+        {
+            const StreamVByteTables& Tables = GetStreamVByteTables();
+            size_t Size = 0;
+            const size_t FullCodes = Count / 4;
+            for( size_t Code = 0 ; Code < FullCodes ; ++Code )
+                { Size += Tables.Lengths[ Control[Code] ]; }
+            // Unused codes in the last byte are zero, which would otherwise count as a byte each.
+            for( size_t Index = FullCodes * 4 ; Index < Count ; ++Index )
+                { Size += GetLengthCode(Index,Control) + 1; }
+            return Size;
+        }
+
+        size_t StreamVByteEncode(const UInt32* In, const size_t Count, UInt8* Out) noexcept
+        {
+            UInt8* Control = Out;
+            UInt8* Data = Out + StreamVByteControlSize(Count);
+            std::fill_n(Control,StreamVByteControlSize(Count),UInt8(0));
+            for( size_t Index = 0 ; Index < Count ; ++Index )
+            {
+                const UInt32 Value = In[Index];
+                const size_t Code = ( Value < ( 1u << 8 ) ? 0 : Value < ( 1u << 16 ) ? 1 : Value < ( 1u << 24 ) ? 2 : 3 );
+                Control[Index / 4] = static_cast<UInt8>( Control[Index / 4] | ( Code << ( ( Index % 4 ) * 2 ) ) );
+                for( size_t Byte = 0 ; Byte <= Code ; ++Byte )
+                    { *Data++ = static_cast<UInt8>( Value >> ( Byte * 8 ) ); }
+            }
+            return static_cast<size_t>(Data - Out);
+        }
+
+        size_t StreamVByteDecode(const UInt8* In, const size_t Count, UInt32* Out) noexcept
+        {
+            const UInt8* Control = In;
+            const UInt8* Data = In + StreamVByteControlSize(Count);
+            size_t Index = 0;
+        #if defined(MEZZ_STREAMVBYTE_SIMD)
+            const StreamVByteTables& Tables = GetStreamVByteTables();
+            const UInt8* DataEnd = Data + StreamVByteDataSize(Control,Count);
+            // Every step loads 16 bytes, so stop while a full load would still be in bounds.
+            for( ; Index + 4 <= Count && DataEnd - Data >= 16 ; Index += 4 )
+            {
+                const UInt8 Code = Control[Index / 4];
+              #if defined(__SSSE3__)
+                const __m128i Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data));
+                const __m128i Shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(Tables.Shuffles[Code]));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(Out + Index),_mm_shuffle_epi8(Block,Shuffle));
+              #else
+                const uint8x16_t Block = vld1q_u8(Data);
+                const uint8x16_t Shuffle = vld1q_u8(Tables.Shuffles[Code]);
+                vst1q_u8(reinterpret_cast<uint8_t*>(Out + Index),vqtbl1q_u8(Block,Shuffle));
+              #endif
+                Data += Tables.Lengths[Code];
+            }
+        #endif
+            for( ; Index < Count ; ++Index )
+            {
+                const size_t Code = GetLengthCode(Index,Control);
+                UInt32 Value = 0;
+                for( size_t Byte = 0 ; Byte <= Code ; ++Byte )
+                    { Value |= UInt32( Data[Byte] ) << ( Byte * 8 ); }
+                Out[Index] = Value;
+                Data += Code + 1;
+            }
+            return static_cast<size_t>(Data - In);
+        }
+    }//VarIntTools
+}//Mezzanine
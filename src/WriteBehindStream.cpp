@@ -0,0 +1,326 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+#include "WriteBehindStream.h"
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // WriteBehindBuffer Methods
+
+    WriteBehindBuffer::WriteBehindBuffer(const StreamSize Size, const size_t BlockCount) :
+        Blocks( std::max(BlockCount,size_t(2)) ),
+        BlockSize( std::max(Size,StreamSize(1)) )
+    {
+        for( WriteBlock& Block : this->Blocks )
+        {
+            Block.Data = BufferPool::Acquire( static_cast<size_t>(this->BlockSize) );
+            this->FreeBlocks.push_back(&Block);
+        }
+    }
+
+    WriteBehindBuffer::WriteBehindBuffer(std::streambuf* Dest, const StreamSize Size, const size_t BlockCount) :
+        WriteBehindBuffer(Size,BlockCount)
+        { this->SetDestination(Dest); }
+
+    WriteBehindBuffer::~WriteBehindBuffer()
+        { this->StopFlusher(); }
+
+    void WriteBehindBuffer::FlushData()
+    {
+        std::unique_lock<std::mutex> Lock(this->BlockLock);
+        while( true )
+        {
+            this->BlockCondition.wait(Lock,[this](){ return this->ShuttingDown || !this->QueuedBlocks.empty(); });
+            if( this->QueuedBlocks.empty() ) {
+                return;
+            }
+
+            WriteBlock* Block = this->QueuedBlocks.front();
+            this->QueuedBlocks.pop_front();
+            this->Writing = true;
+
+            Lock.unlock();
+            const StreamSize BytesWritten = this->Destination->sputn(Block->Data.get(),Block->Size);
+            Lock.lock();
+
+            this->Writing = false;
+            if( BytesWritten < Block->Size ) {
+                this->Failed = true;
+            }
+            Block->Size = 0;
+            this->FreeBlocks.push_back(Block);
+            this->BlockCondition.notify_all();
+        }
+    }
+
+    void WriteBehindBuffer::StartFlusher()
+    {
+        this->ShuttingDown = false;
+        this->Flusher = std::thread([this](){ this->FlushData(); });
+    }
+
+    void WriteBehindBuffer::StopFlusher()
+    {
+        if( !this->Flusher.joinable() ) {
+            return;
+        }
+        {
+            std::unique_lock<std::mutex> Lock(this->BlockLock);
+            this->DrainBlocks(Lock);
+            this->ShuttingDown = true;
+        }
+        this->BlockCondition.notify_all();
+        this->Flusher.join();
+    }
+
+    Boole WriteBehindBuffer::SubmitBlock(std::unique_lock<std::mutex>& Lock)
+    {
+        if( this->Current != nullptr && this->pptr() > this->pbase() ) {
+            this->Current->Size = this->pptr() - this->pbase();
+            this->CurrentStart += this->Current->Size;
+            this->EndPosition = std::max(this->EndPosition,this->CurrentStart);
+            this->QueuedBlocks.push_back(this->Current);
+            this->Current = nullptr;
+            this->setp(nullptr,nullptr);
+            this->BlockCondition.notify_all();
+        }
+        if( this->Current == nullptr ) {
+            this->BlockCondition.wait(Lock,[this](){ return !this->FreeBlocks.empty(); });
+            this->Current = this->FreeBlocks.back();
+            this->FreeBlocks.pop_back();
+            Char8* Data = this->Current->Data.get();
+            this->setp(Data,Data + this->BlockSize);
+        }
+        return !this->Failed;
+    }
+
+    Boole WriteBehindBuffer::DrainBlocks(std::unique_lock<std::mutex>& Lock)
+    {
+        this->SubmitBlock(Lock);
+        this->BlockCondition.wait(Lock,[this](){ return this->QueuedBlocks.empty() && !this->Writing; });
+        return !this->Failed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Configuration
+
+    void WriteBehindBuffer::SetDestination(std::streambuf* Dest)
+    {
+        this->StopFlusher();
+        if( this->Destination != nullptr ) {
+            this->Destination->pubsync();
+        }
+        // Draining leaves an empty block in the put area; give it back so writes without a destination fail.
+        if( this->Current != nullptr ) {
+            this->FreeBlocks.push_back(this->Current);
+            this->Current = nullptr;
+        }
+        this->setp(nullptr,nullptr);
+
+        this->Destination = Dest;
+        this->Failed = false;
+        this->CurrentStart = 0;
+        this->EndPosition = 0;
+        if( Dest != nullptr ) {
+            const StreamPos Start = Dest->pubseekoff(0,std::ios_base::cur,std::ios_base::out);
+            if( Start != StreamPos(StreamOff(-1)) ) {
+                const StreamPos End = Dest->pubseekoff(0,std::ios_base::end,std::ios_base::out);
+                Dest->pubseekpos(Start,std::ios_base::out);
+                this->CurrentStart = StreamOff(Start);
+                this->EndPosition = std::max(StreamOff(Start),StreamOff(End));
+            }
+            this->StartFlusher();
+        }
+    }
+
+    std::streambuf* WriteBehindBuffer::GetDestination() const noexcept
+        { return this->Destination; }
+
+    StreamSize WriteBehindBuffer::GetBlockSize() const noexcept
+        { return this->BlockSize; }
+
+    size_t WriteBehindBuffer::GetBlockCount() const noexcept
+        { return this->Blocks.size(); }
+
+    StreamSize WriteBehindBuffer::GetEndPosition() const noexcept
+        { return std::max(this->EndPosition,this->CurrentStart + ( this->pptr() - this->pbase() )); }
+
+    Boole WriteBehindBuffer::WaitForWrites()
+    {
+        if( this->Destination == nullptr ) {
+            return false;
+        }
+        std::unique_lock<std::mutex> Lock(this->BlockLock);
+        const Boole Written = this->DrainBlocks(Lock);
+        return ( this->Destination->pubsync() == 0 ) && Written;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Internal Buffer Operations
+
+    WriteBehindBuffer::int_type WriteBehindBuffer::overflow(int_type Character)
+    {
+        if( this->Destination == nullptr ) {
+            return traits_type::eof();
+        }
+        {
+            std::unique_lock<std::mutex> Lock(this->BlockLock);
+            if( !this->SubmitBlock(Lock) ) {
+                return traits_type::eof();
+            }
+        }
+        if( !traits_type::eq_int_type(Character,traits_type::eof()) ) {
+            *( this->pptr() ) = traits_type::to_char_type(Character);
+            this->pbump(1);
+        }
+        return traits_type::not_eof(Character);
+    }
+
+    int WriteBehindBuffer::sync()
+    {
+        if( this->Destination == nullptr ) {
+            return -1;
+        }
+        std::unique_lock<std::mutex> Lock(this->BlockLock);
+        return ( this->SubmitBlock(Lock) ? 0 : -1 );
+    }
+
+    WriteBehindBuffer::pos_type WriteBehindBuffer::seekoff(off_type Offset,
+                                                           std::ios_base::seekdir Origin,
+                                                           std::ios_base::openmode Mode)
+    {
+        if( !( Mode & std::ios_base::out ) || this->Destination == nullptr ) {
+            return pos_type(off_type(-1));
+        }
+        if( Offset == 0 && Origin == std::ios_base::cur ) {
+            return pos_type( this->CurrentStart + ( this->pptr() - this->pbase() ) );
+        }
+
+        std::unique_lock<std::mutex> Lock(this->BlockLock);
+        if( !this->DrainBlocks(Lock) ) {
+            return pos_type(off_type(-1));
+        }
+        const pos_type Result = this->Destination->pubseekoff(Offset,Origin,std::ios_base::out);
+        if( Result != pos_type(off_type(-1)) ) {
+            this->CurrentStart = off_type(Result);
+        }
+        return Result;
+    }
+
+    WriteBehindBuffer::pos_type WriteBehindBuffer::seekpos(pos_type Position, std::ios_base::openmode Mode)
+        { return this->seekoff(off_type(Position),std::ios_base::beg,Mode); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // WriteBehindOutputStream Methods
+
+    WriteBehindOutputStream::WriteBehindOutputStream(const StreamSize Size, const size_t BlockCount) :
+        OutputStream(&WriteBuffer),
+        WriteBuffer(Size,BlockCount)
+        {  }
+
+    WriteBehindOutputStream::WriteBehindOutputStream(const String& File,
+                                                     const Boole Append,
+                                                     const StreamSize Size,
+                                                     const size_t BlockCount) :
+        OutputStream(&WriteBuffer),
+        WriteBuffer(Size,BlockCount)
+        { this->OpenFile(File,Append); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // File Operations
+
+    void WriteBehindOutputStream::OpenFile(const String& File, const Boole Append)
+    {
+        this->CloseFile();
+        const std::ios_base::openmode Mode = std::ios_base::out | std::ios_base::binary |
+                                             ( Append ? std::ios_base::app : std::ios_base::trunc );
+        if( this->FileBuffer.open(File,Mode) == nullptr ) {
+            this->setstate(std::ios_base::failbit);
+            return;
+        }
+        if( Append ) {
+            this->FileBuffer.pubseekoff(0,std::ios_base::end,std::ios_base::out);
+        }
+
+        this->FileName = File;
+        this->WriteBuffer.SetDestination(&FileBuffer);
+        this->clear();
+    }
+
+    void WriteBehindOutputStream::CloseFile()
+    {
+        this->WriteBuffer.SetDestination(nullptr);
+        this->FileBuffer.close();
+        this->FileName.clear();
+    }
+
+    Boole WriteBehindOutputStream::IsOpen() const
+        { return this->FileBuffer.is_open(); }
+
+    Boole WriteBehindOutputStream::FlushAndWait()
+    {
+        if( !this->WriteBuffer.WaitForWrites() ) {
+            this->setstate(std::ios_base::badbit);
+        }
+        return !this->fail();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Stream Base Operations
+
+    String WriteBehindOutputStream::GetIdentifier() const
+        { return this->FileName; }
+
+    String WriteBehindOutputStream::GetGroup() const
+        { return String(); }
+
+    StreamSize WriteBehindOutputStream::GetSize() const
+        { return this->WriteBuffer.GetEndPosition(); }
+
+    Boole WriteBehindOutputStream::CanSeek() const
+        { return true; }
+
+    Boole WriteBehindOutputStream::IsEncrypted() const
+        { return false; }
+
+    Boole WriteBehindOutputStream::IsRaw() const
+        { return true; }
+}//Mezzanine
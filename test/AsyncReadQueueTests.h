@@ -0,0 +1,100 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_AsyncReadQueueTests_h
+#define Mezz_IOStreams_AsyncReadQueueTests_h
+
+/// @file
+/// @brief This file tests the functionality of the AsyncReadQueue class.
+
+#include "MezzTest.h"
+
+#include "AsyncReadQueue.h"
+
+#include <atomic>
+
+AUTOMATIC_TEST_GROUP(AsyncReadQueueTests,AsyncReadQueue)
+{
+    using namespace Mezzanine;
+
+    {//Construction
+        AsyncReadQueue NoThreadQueue(0);
+        TEST_EQUAL("AsyncReadQueue(const_size_t)-MinimumThreads",
+                   size_t(1),NoThreadQueue.GetThreadCount())
+        AsyncReadQueue ThreeThreadQueue(3);
+        TEST_EQUAL("AsyncReadQueue(const_size_t)-ThreeThreads",
+                   size_t(3),ThreeThreadQueue.GetThreadCount())
+        TEST_EQUAL("GetDefault()-ThreadCount",
+                   true,AsyncReadQueue::GetDefault().GetThreadCount() >= 4)
+    }//Construction
+
+    {//Submit
+        AsyncReadQueue TestQueue(4);
+        std::atomic<int> Completed(0);
+        std::vector< std::future<StreamSize> > Results;
+        for( StreamSize Count = 0 ; Count < 32 ; ++Count )
+        {
+            Results.push_back( TestQueue.Submit([&Completed,Count](){
+                ++Completed;
+                return Count;
+            }) );
+        }
+
+        StreamSize ResultSum = 0;
+        for( std::future<StreamSize>& Result : Results )
+        {
+            ResultSum += Result.get();
+        }
+        TEST_EQUAL("Submit(ReadTask)-Results",
+                   StreamSize(496),ResultSum)
+        TEST_EQUAL("Submit(ReadTask)-Completed",
+                   32,Completed.load())
+        TEST_EQUAL("GetPendingCount()",
+                   size_t(0),TestQueue.GetPendingCount())
+
+        std::future<StreamSize> Failure = TestQueue.Submit([]() -> StreamSize {
+            throw std::runtime_error("Read failed.");
+        });
+        TEST_THROW("Submit(ReadTask)-Exception",
+                   std::runtime_error,
+                   [&](){ Failure.get(); })
+    }//Submit
+}
+
+#endif // Mezz_IOStreams_AsyncReadQueueTests_h
@@ -47,6 +47,11 @@
 
 #include "BinaryStreamReader.h"
 
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
 /// @brief A struct of values to use with the BinaryStreamReader tests.
 struct BinaryStreamReaderStruct
 {
@@ -80,6 +85,36 @@ public:
     }
     ~BinaryStreamReaderBuffer() = default;
 };//BinaryStreamReaderBuffer
+
+/// @brief A streambuf that only exposes a few bytes of the test struct at a time, so values straddle the get area.
+class BinaryStreamReaderChunkedBuffer : public std::streambuf
+{
+protected:
+    /// @brief The start of the test struct.
+    char* Data;
+    /// @brief The position of the next chunk.
+    size_t Position = 0;
+public:
+    /// @brief Class constructor.
+    /// @param Struct A pointer to the test struct being streamed from.
+    BinaryStreamReaderChunkedBuffer(BinaryStreamReaderStruct* Struct) :
+        Data(reinterpret_cast<char*>(Struct))
+        {  }
+    ~BinaryStreamReaderChunkedBuffer() = default;
+
+    /// @copydoc std::streambuf::underflow()
+    int_type underflow() override
+    {
+        if( this->Position >= sizeof(BinaryStreamReaderStruct) ) {
+            return traits_type::eof();
+        }
+        const size_t ChunkSize = std::min(size_t(3),sizeof(BinaryStreamReaderStruct) - this->Position);
+        char* Chunk = this->Data + this->Position;
+        this->Position += ChunkSize;
+        this->setg(Chunk,Chunk,Chunk + ChunkSize);
+        return traits_type::to_int_type(*Chunk);
+    }
+};//BinaryStreamReaderChunkedBuffer
 RESTORE_WARNING_STATE
 
 SAVE_WARNING_STATE
@@ -145,6 +180,208 @@ AUTOMATIC_TEST_GROUP(BinaryStreamReaderTests,BinaryStreamReader)
 
     TEST_EQUAL("AtEnd()_const-End",
                true,TestReader.AtEnd())
+
+    {//CallerBuffers
+        BinaryStreamReaderBuffer ReuseBuffer(&TestStruct);
+        StdInputStreamPtr ReuseStream = std::make_shared<std::istream>(&ReuseBuffer);
+        BinaryStreamReader ReuseReader(ReuseStream);
+
+        double DoubleVar = 0.0;
+        TEST_EQUAL("Read(void*,const_StreamSize)-DoubleVar-Count",
+                   StreamSize( sizeof(double) ),ReuseReader.Read(&DoubleVar,sizeof(double)))
+        TEST_EQUAL_EPSILON("Read(void*,const_StreamSize)-DoubleVar-Value",
+                           TestStruct.DoubleVar,DoubleVar)
+
+        BinaryBuffer FloatPairBuffer( sizeof(float) * 2 );
+        TEST_EQUAL("Read(BinaryBuffer&)-FloatVars-Count",
+                   StreamSize( sizeof(float) * 2 ),ReuseReader.Read(FloatPairBuffer))
+        TEST_EQUAL_EPSILON("Read(BinaryBuffer&)-FloatVars-Value",
+                           TestStruct.FloatVar2,reinterpret_cast<float*>(FloatPairBuffer.Binary)[1])
+
+        StringView UIntView = ReuseReader.ReadView( sizeof(UInt32) * 4 );
+        TEST_EQUAL("ReadView(const_StreamSize)-UIntVars-Size",
+                   sizeof(UInt32) * 4,UIntView.size())
+        UInt32 UIntVar4 = 0;
+        std::memcpy(&UIntVar4,UIntView.data() + sizeof(UInt32) * 3,sizeof(UInt32));
+        TEST_EQUAL("ReadView(const_StreamSize)-UIntVars-Value",
+                   TestStruct.UIntVar4,UIntVar4)
+
+        const char* ScratchData = UIntView.data();
+        StringView ShortView = ReuseReader.ReadView( sizeof(short) * 2 );
+        TEST_EQUAL("ReadView(const_StreamSize)-ShortVars-Reused",
+                   true,ScratchData == ShortView.data())
+        StringView TailView = ReuseReader.ReadView(100);
+        TEST_EQUAL("ReadView(const_StreamSize)-ShortRead-Size",
+                   size_t(4),TailView.size())
+        TEST_EQUAL("ReadView(const_StreamSize)-ShortRead-Value",
+                   String("c0\t"),String(TailView.substr(0,3)))
+    }//CallerBuffers
+
+    {//ShortRead
+        BinaryStreamReaderBuffer ShortReadBuffer(&TestStruct);
+        StdInputStreamPtr ShortStream = std::make_shared<std::istream>(&ShortReadBuffer);
+        BinaryStreamReader ShortReader(ShortStream);
+        ShortReader.Skip(36);
+        BinaryBuffer Remaining = ShortReader.Read(100);
+        TEST_EQUAL("Read(const_StreamSize)-ShortRead-BufferSize",
+                   SizeType(4),Remaining.Size)
+        TEST_EQUAL("Read(const_StreamSize)-ShortRead-Value",
+                   TestStruct.CharVar1,static_cast<char>(Remaining.Binary[0]))
+    }//ShortRead
+
+    {//BufferBoundaries
+        BinaryStreamReaderChunkedBuffer ChunkedBuffer(&TestStruct);
+        StdInputStreamPtr ChunkedStream = std::make_shared<std::istream>(&ChunkedBuffer);
+        BinaryStreamReader ChunkedReader(ChunkedStream);
+        TEST_EQUAL_EPSILON("Read(T)-Straddling-DoubleVar",
+                           TestStruct.DoubleVar,ChunkedReader.Read<double>())
+        TEST_EQUAL_EPSILON("Read(T)-Straddling-FloatVar1",
+                           TestStruct.FloatVar1,ChunkedReader.Read<float>())
+        ChunkedReader.Skip( sizeof(float) );
+        TEST_EQUAL("Read(T)-Straddling-UIntVar1",
+                   TestStruct.UIntVar1,ChunkedReader.Read<UInt32>())
+
+        BinaryStreamReaderBuffer FailedBuffer(&TestStruct);
+        StdInputStreamPtr FailedStream = std::make_shared<std::istream>(&FailedBuffer);
+        BinaryStreamReader FailedReader(FailedStream);
+        FailedStream->setstate(std::ios_base::failbit);
+        TEST_EQUAL("Read(T)-FailedStream",
+                   0.0,FailedReader.Read<double>())
+        FailedStream->clear();
+        TEST_EQUAL_EPSILON("Read(T)-ClearedStream",
+                           TestStruct.DoubleVar,FailedReader.Read<double>())
+    }//BufferBoundaries
+
+    {//Arrays
+        const String BigEndianData("\x00\x00\x00\x01\x00\x00\x01\x00\x01\x02\x03\x04\xFF",13);
+        StdInputStreamPtr ArrayStream = std::make_shared<std::istringstream>(BigEndianData);
+        BinaryStreamReader ArrayReader(ArrayStream);
+        UInt32 Values[4] = {};
+        TEST_EQUAL("ReadArray(Datum*,const_size_t,const_ByteOrder)-Count",
+                   size_t(3),ArrayReader.ReadArray(Values,4,ByteOrder::Big))
+        TEST_EQUAL("ReadArray(Datum*,const_size_t,const_ByteOrder)-First",
+                   UInt32(1),Values[0])
+        TEST_EQUAL("ReadArray(Datum*,const_size_t,const_ByteOrder)-Second",
+                   UInt32(256),Values[1])
+        TEST_EQUAL("ReadArray(Datum*,const_size_t,const_ByteOrder)-Third",
+                   UInt32(0x01020304),Values[2])
+
+        StdInputStreamPtr NativeStream = std::make_shared<std::istringstream>(BigEndianData);
+        BinaryStreamReader NativeReader(NativeStream);
+        UInt16 NativeValues[2] = {};
+        NativeReader.ReadArray(NativeValues,2);
+        UInt16 Expected = 0;
+        std::memcpy(&Expected,BigEndianData.data() + 2,sizeof(UInt16));
+        TEST_EQUAL("ReadArray(Datum*,const_size_t,const_ByteOrder)-Native",
+                   Expected,NativeValues[1])
+    }//Arrays
+
+    {//VariableLength
+        // 150, -2, 300 then padding so the fast path can be taken.
+        const String VarIntData("\x96\x01\x03\xAC\x02\x00\x00\x00\x00\x00\x00\x00\x00\x00",14);
+        StdInputStreamPtr VarIntStream = std::make_shared<std::istringstream>(VarIntData);
+        BinaryStreamReader VarIntReader(VarIntStream);
+        TEST_EQUAL("ReadVarInt()-Buffered",
+                   UInt64(150),VarIntReader.ReadVarInt())
+        TEST_EQUAL("ReadZigZag()-Buffered",
+                   Int64(-2),VarIntReader.ReadZigZag())
+        TEST_EQUAL("ReadVarInt()-Buffered-Second",
+                   UInt64(300),VarIntReader.ReadVarInt())
+
+        StdInputStreamPtr ShortVarIntStream = std::make_shared<std::istringstream>(VarIntData.substr(0,5));
+        BinaryStreamReader ShortVarIntReader(ShortVarIntStream);
+        TEST_EQUAL("ReadVarInt()-Unbuffered",
+                   UInt64(150),ShortVarIntReader.ReadVarInt())
+        TEST_EQUAL("ReadZigZag()-Unbuffered",
+                   Int64(-2),ShortVarIntReader.ReadZigZag())
+        TEST_EQUAL("ReadVarInt()-Unbuffered-Second",
+                   UInt64(300),ShortVarIntReader.ReadVarInt())
+        TEST_EQUAL("ReadVarInt()-PastEnd",
+                   UInt64(0),ShortVarIntReader.ReadVarInt())
+        TEST_EQUAL("ReadVarInt()-PastEnd-Fail",
+                   true,ShortVarIntStream->fail())
+
+        StdInputStreamPtr BadVarIntStream = std::make_shared<std::istringstream>(String(12,'\xFF'));
+        BinaryStreamReader BadVarIntReader(BadVarIntStream);
+        TEST_EQUAL("ReadVarInt()-Malformed",
+                   UInt64(0),BadVarIntReader.ReadVarInt())
+        TEST_EQUAL("ReadVarInt()-Malformed-Fail",
+                   true,BadVarIntStream->fail())
+
+        // Values 1, 300, 70000, 16777216 and 9.
+        const String VByteData("\xE4\x00\x01\x2C\x01\x70\x11\x01\x00\x00\x00\x01\x09",13);
+        StdInputStreamPtr VByteStream = std::make_shared<std::istringstream>(VByteData);
+        BinaryStreamReader VByteReader(VByteStream);
+        UInt32 VByteValues[5] = {};
+        TEST_EQUAL("ReadStreamVByte(UInt32*,const_size_t)-Count",
+                   size_t(5),VByteReader.ReadStreamVByte(VByteValues,5))
+        TEST_EQUAL("ReadStreamVByte(UInt32*,const_size_t)-Values",
+                   true,VByteValues[0] == 1 && VByteValues[1] == 300 && VByteValues[2] == 70000 &&
+                        VByteValues[3] == 16777216 && VByteValues[4] == 9)
+        TEST_EQUAL("ReadStreamVByte(UInt32*,const_size_t)-AtEnd",
+                   true,VByteReader.AtEnd())
+
+        StdInputStreamPtr TruncatedStream = std::make_shared<std::istringstream>(VByteData.substr(0,10));
+        BinaryStreamReader TruncatedReader(TruncatedStream);
+        TEST_EQUAL("ReadStreamVByte(UInt32*,const_size_t)-Truncated",
+                   size_t(0),TruncatedReader.ReadStreamVByte(VByteValues,5))
+    }//VariableLength
+
+    {//Records
+        const String RecordData("\x01\x02\x03\x04\x05\x06\x07\x08",8);
+        StdInputStreamPtr RecordStream = std::make_shared<std::istringstream>(RecordData);
+        BinaryStreamReader RecordReader(RecordStream);
+        const auto [BigWord, Byte, BigShort] = RecordReader.ReadTuple<UInt32,UInt8,UInt16>(ByteOrder::Big);
+        TEST_EQUAL("ReadTuple(const_ByteOrder)-First",
+                   UInt32(0x01020304),BigWord)
+        TEST_EQUAL("ReadTuple(const_ByteOrder)-Second",
+                   UInt8(5),Byte)
+        TEST_EQUAL("ReadTuple(const_ByteOrder)-Third",
+                   UInt16(0x0607),BigShort)
+        const std::tuple<UInt16,UInt8> PastEnd = RecordReader.ReadTuple<UInt16,UInt8>();
+        TEST_EQUAL("ReadTuple(const_ByteOrder)-PastEnd",
+                   true,std::get<0>(PastEnd) == 0 && std::get<1>(PastEnd) == 0)
+        TEST_EQUAL("ReadTuple(const_ByteOrder)-PastEnd-Fail",
+                   true,RecordStream->fail())
+
+        BinaryStreamReaderBuffer StructBuffer(&TestStruct);
+        StdInputStreamPtr StructStream = std::make_shared<std::istream>(&StructBuffer);
+        BinaryStreamReader StructReader(StructStream);
+        const BinaryStreamReaderStruct Record = StructReader.ReadStruct<BinaryStreamReaderStruct>();
+        TEST_EQUAL("ReadStruct()-Value",
+                   true,std::memcmp(&Record,&TestStruct,sizeof(BinaryStreamReaderStruct)) == 0)
+        TEST_EQUAL("ReadStruct()-AtEnd",
+                   true,StructReader.Read<char>() == 0 && StructStream->eof())
+
+        BinaryStreamReaderChunkedBuffer ChunkedRecordBuffer(&TestStruct);
+        StdInputStreamPtr ChunkedRecordStream = std::make_shared<std::istream>(&ChunkedRecordBuffer);
+        BinaryStreamReader ChunkedRecordReader(ChunkedRecordStream);
+        const auto Straddling = ChunkedRecordReader.ReadTuple<double,float,float,UInt32>();
+        TEST_EQUAL("ReadTuple(const_ByteOrder)-Straddling",
+                   TestStruct.UIntVar1,std::get<3>(Straddling))
+    }//Records
+
+    {//EncodedFloats
+        const String HalfData("\x3C\x00\xC0\x00\x38\x00\x7C",7);
+        StdInputStreamPtr HalfStream = std::make_shared<std::istringstream>(HalfData);
+        BinaryStreamReader HalfReader(HalfStream);
+        float Values[4] = {};
+        TEST_EQUAL("ReadFloats(float*,const_size_t,const_FloatEncoding,const_ByteOrder)-Half-Count",
+                   size_t(3),HalfReader.ReadFloats(Values,4,FloatEncoding::Half,ByteOrder::Big))
+        TEST_EQUAL("ReadFloats(float*,const_size_t,const_FloatEncoding,const_ByteOrder)-Half-Values",
+                   true,Values[0] == 1.0f && Values[1] == -2.0f && Values[2] == 0.5f)
+
+        String SNormData;
+        for( size_t Count = 0 ; Count < 3000 ; ++Count )
+            { SNormData.append("\x00\x20",2); }
+        StdInputStreamPtr SNormStream = std::make_shared<std::istringstream>(SNormData);
+        BinaryStreamReader SNormReader(SNormStream);
+        std::vector<float> Many(3000);
+        TEST_EQUAL("ReadFloats(float*,const_size_t,const_FloatEncoding,const_ByteOrder)-Large-Count",
+                   Many.size(),SNormReader.ReadFloats(Many.data(),Many.size(),FloatEncoding::SNorm16,ByteOrder::Little))
+        TEST_EQUAL("ReadFloats(float*,const_size_t,const_FloatEncoding,const_ByteOrder)-Large-Last",
+                   true,std::abs(Many.back() - 0.25f) < 0.0001f)
+    }//EncodedFloats
 }
 RESTORE_WARNING_STATE
 
@@ -48,6 +48,10 @@
 
 #include "BinaryStreamWriter.h"
 
+#include <cstring>
+#include <sstream>
+#include <vector>
+
 /// @brief A struct of values to use with the BinaryStreamReader tests.
 struct BinaryStreamWriterStruct
 {
@@ -203,6 +207,120 @@ AUTOMATIC_TEST_GROUP(BinaryStreamWriterTests,BinaryStreamWriter)
     TEST_THROW("Write(const_BinaryBuffer&)-Throw",
                Mezzanine::Exception::StreamOverflow,
                [&](){ TestWriter.Write(ReusableBuffer); })
+
+    {//BufferBoundaries
+        std::shared_ptr<std::stringstream> StringStream = std::make_shared<std::stringstream>();
+        BinaryStreamWriter StringWriter(StringStream);
+        String Expected;
+        for( UInt32 Value = 0 ; Value < 1000 ; ++Value )
+        {
+            StringWriter.Write(Value);
+            StringWriter.Write( static_cast<UInt16>(Value) );
+            Expected.append(reinterpret_cast<const char*>(&Value),sizeof(UInt32));
+            const UInt16 Short = static_cast<UInt16>(Value);
+            Expected.append(reinterpret_cast<const char*>(&Short),sizeof(UInt16));
+        }
+        TEST_EQUAL("Write(T)-GrowingBuffer",
+                   Expected,StringStream->str())
+
+        StringStream->setstate(std::ios_base::failbit);
+        TEST_EQUAL("Write(T)-FailedStream-Valid",
+                   false,StringWriter.Write( UInt32(7) ))
+        TEST_EQUAL("Write(T)-FailedStream-Unchanged",
+                   Expected.size(),StringStream->str().size())
+    }//BufferBoundaries
+
+    {//Arrays
+        std::shared_ptr<std::stringstream> ArrayStream = std::make_shared<std::stringstream>();
+        BinaryStreamWriter ArrayWriter(ArrayStream);
+        const UInt16 Shorts[3] = { 0x0102, 0x0304, 0x0506 };
+        TEST_EQUAL("WriteArray(const_Datum*,const_size_t,const_ByteOrder)-Big-Valid",
+                   true,ArrayWriter.WriteArray(Shorts,3,ByteOrder::Big))
+        TEST_EQUAL("WriteArray(const_Datum*,const_size_t,const_ByteOrder)-Big-Value",
+                   String("\x01\x02\x03\x04\x05\x06",6),ArrayStream->str())
+        TEST_EQUAL("WriteArray(const_Datum*,const_size_t,const_ByteOrder)-SourceUntouched",
+                   UInt16(0x0304),Shorts[1])
+
+        std::vector<UInt32> Many(5000);
+        for( size_t Index = 0 ; Index < Many.size() ; ++Index )
+            { Many[Index] = static_cast<UInt32>(Index); }
+        ArrayStream->str("");
+        ArrayWriter.WriteArray(Many.data(),Many.size(),ByteOrder::Little);
+        ArrayWriter.WriteArray(Many.data(),Many.size(),ByteOrder::Big);
+        const String Written = ArrayStream->str();
+        TEST_EQUAL("WriteArray(const_Datum*,const_size_t,const_ByteOrder)-Large-Size",
+                   Many.size() * sizeof(UInt32) * 2,Written.size())
+        const size_t LastBig = Written.size() - sizeof(UInt32);
+        TEST_EQUAL("WriteArray(const_Datum*,const_size_t,const_ByteOrder)-Large-Little",
+                   String("\x87\x13\x00\x00",4),Written.substr(LastBig - Many.size() * sizeof(UInt32),4))
+        TEST_EQUAL("WriteArray(const_Datum*,const_size_t,const_ByteOrder)-Large-Big",
+                   String("\x00\x00\x13\x87",4),Written.substr(LastBig,4))
+    }//Arrays
+
+    {//VariableLength
+        std::shared_ptr<std::stringstream> VarIntStream = std::make_shared<std::stringstream>();
+        BinaryStreamWriter VarIntWriter(VarIntStream);
+        TEST_EQUAL("WriteVarInt(const_UInt64)-Valid",
+                   true,VarIntWriter.WriteVarInt(300))
+        TEST_EQUAL("WriteZigZag(const_Int64)-Valid",
+                   true,VarIntWriter.WriteZigZag(-1))
+        TEST_EQUAL("WriteVarInt(const_UInt64)-Value",
+                   String("\xAC\x02\x01",3),VarIntStream->str())
+
+        VarIntStream->str("");
+        const UInt32 Values[5] = { 1, 300, 70000, 16777216, 9 };
+        TEST_EQUAL("WriteStreamVByte(const_UInt32*,const_size_t)-Valid",
+                   true,VarIntWriter.WriteStreamVByte(Values,5))
+        TEST_EQUAL("WriteStreamVByte(const_UInt32*,const_size_t)-Value",
+                   String("\xE4\x00\x01\x2C\x01\x70\x11\x01\x00\x00\x00\x01\x09",13),VarIntStream->str())
+    }//VariableLength
+
+    {//Records
+        std::shared_ptr<std::stringstream> RecordStream = std::make_shared<std::stringstream>();
+        BinaryStreamWriter RecordWriter(RecordStream);
+        TEST_EQUAL("WriteTuple(const_std::tuple<Data...>&,const_ByteOrder)-Valid",
+                   true,RecordWriter.WriteTuple(std::make_tuple(UInt32(0x01020304),UInt8(5),UInt16(0x0607)),ByteOrder::Big))
+        TEST_EQUAL("WriteTuple(const_std::tuple<Data...>&,const_ByteOrder)-Value",
+                   String("\x01\x02\x03\x04\x05\x06\x07",7),RecordStream->str())
+
+        RecordStream->str("");
+        BinaryStreamWriterStruct Record;
+        Record.UIntVar3 = 975454;
+        Record.CharVar2 = '0';
+        TEST_EQUAL("WriteStruct(const_Record&)-Valid",
+                   true,RecordWriter.WriteStruct(Record))
+        BinaryStreamWriterStruct Written;
+        const String Bytes = RecordStream->str();
+        TEST_EQUAL("WriteStruct(const_Record&)-Size",
+                   sizeof(BinaryStreamWriterStruct),Bytes.size())
+        std::memcpy(&Written,Bytes.data(),sizeof(BinaryStreamWriterStruct));
+        TEST_EQUAL("WriteStruct(const_Record&)-Value",
+                   true,Written.UIntVar3 == 975454 && Written.CharVar2 == '0')
+    }//Records
+
+    {//EncodedFloats
+        std::shared_ptr<std::stringstream> FloatStream = std::make_shared<std::stringstream>();
+        BinaryStreamWriter FloatWriter(FloatStream);
+        const float Values[3] = { 1.0f, -2.0f, 0.5f };
+        TEST_EQUAL("WriteFloats(const_float*,const_size_t,const_FloatEncoding,const_ByteOrder)-Half-Valid",
+                   true,FloatWriter.WriteFloats(Values,3,FloatEncoding::Half,ByteOrder::Big))
+        TEST_EQUAL("WriteFloats(const_float*,const_size_t,const_FloatEncoding,const_ByteOrder)-Half-Value",
+                   String("\x3C\x00\xC0\x00\x38\x00",6),FloatStream->str())
+
+        FloatStream->str("");
+        FloatWriter.WriteFloats(Values,3,FloatEncoding::UNorm8);
+        TEST_EQUAL("WriteFloats(const_float*,const_size_t,const_FloatEncoding,const_ByteOrder)-UNorm8",
+                   String("\xFF\x00\x80",3),FloatStream->str())
+
+        std::vector<float> Many(5000,0.25f);
+        FloatStream->str("");
+        FloatWriter.WriteFloats(Many.data(),Many.size(),FloatEncoding::SNorm16,ByteOrder::Little);
+        const String Written = FloatStream->str();
+        TEST_EQUAL("WriteFloats(const_float*,const_size_t,const_FloatEncoding,const_ByteOrder)-Large-Size",
+                   Many.size() * 2,Written.size())
+        TEST_EQUAL("WriteFloats(const_float*,const_size_t,const_FloatEncoding,const_ByteOrder)-Large-Last",
+                   String("\x00\x20",2),Written.substr(Written.size() - 2))
+    }//EncodedFloats
 }
 
 #endif // Mezz_IOStreams_BinaryStreamWriterTests_h
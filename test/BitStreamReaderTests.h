@@ -0,0 +1,140 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_BitStreamReaderTests_h
+#define Mezz_IOStreams_BitStreamReaderTests_h
+
+/// @file
+/// @brief This file tests the functionality of the BitStreamReader class.
+
+#include "MezzTest.h"
+
+#include "BitStreamReader.h"
+
+#include <sstream>
+
+AUTOMATIC_TEST_GROUP(BitStreamReaderTests,BitStreamReader)
+{
+    using namespace Mezzanine;
+
+    {//Unpacking
+        StdInputStreamPtr TestStream = std::make_shared<std::istringstream>(String("\x5D\xFF\x07",3));
+        BitStreamReader TestReader(TestStream);
+        TEST_EQUAL("PeekBits(const_UInt32)",
+                   UInt64(0x5),TestReader.PeekBits(3))
+        TEST_EQUAL("ReadBits(const_UInt32)-ThreeBits",
+                   UInt64(0x5),TestReader.ReadBits(3))
+        TEST_EQUAL("ReadBits(const_UInt32)-TwoBits",
+                   UInt64(0x3),TestReader.ReadBits(2))
+        TEST_EQUAL("ReadBit()-False",
+                   false,TestReader.ReadBit())
+        TEST_EQUAL("ReadBit()-True",
+                   true,TestReader.ReadBit())
+        TestReader.AlignToByte();
+        TEST_EQUAL("GetBitsRead()_const-Aligned",
+                   UInt64(8),TestReader.GetBitsRead())
+        TEST_EQUAL("ReadBits(const_UInt32)-AcrossBytes",
+                   UInt64(0x7FF),TestReader.ReadBits(11))
+        TEST_EQUAL("Fail()-NotAtEnd",
+                   false,TestStream->fail())
+        TEST_EQUAL("ReadBits(const_UInt32)-PastEnd",
+                   UInt64(0),TestReader.ReadBits(8))
+        TEST_EQUAL("Fail()-PastEnd",
+                   true,TestStream->fail())
+    }//Unpacking
+
+    {//Words
+        String Encoded("\xF1\xDE\xBC\x9A\x78\x56\x34\x12\x00",9);
+        Encoded.append(32,'\xAA');
+        StdInputStreamPtr TestStream = std::make_shared<std::istringstream>(Encoded);
+        BitStreamReader TestReader(TestStream);
+        TEST_EQUAL("ReadBits(const_UInt32)-Nibble",
+                   UInt64(0x1),TestReader.ReadBits(4))
+        TEST_EQUAL("ReadBits(const_UInt32)-FullWord",
+                   UInt64(0x0123456789ABCDEF),TestReader.ReadBits(64))
+        TEST_EQUAL("SkipBits(const_UInt64)",
+                   UInt64(4),TestReader.SkipBits(4))
+
+        UInt64 Pattern = 0;
+        for( size_t Count = 0 ; Count < 16 ; ++Count )
+            { Pattern = ( Pattern << 1 ) | TestReader.ReadBits(1); }
+        TEST_EQUAL("ReadBits(const_UInt32)-Alternating",
+                   UInt64(0x5555),Pattern)
+        TEST_EQUAL("ReadBits(const_UInt32)-Wide",
+                   UInt64(0xAAAAAAAAAAAAAA),TestReader.ReadBits(56))
+
+        TEST_EQUAL("SyncStreamPosition()",
+                   true,TestReader.SyncStreamPosition())
+        TEST_EQUAL("SyncStreamPosition()-Position",
+                   StreamPos(18),TestStream->tellg())
+    }//Words
+
+    {//RoundTrip
+        // Enough values of mixed widths to use both the word and the byte refill paths.
+        std::stringstream Packed;
+        UInt64 Expected = 0;
+        for( UInt32 Index = 0 ; Index < 500 ; ++Index )
+        {
+            const UInt32 Width = Index % 13 + 1;
+            const UInt64 Value = ( UInt64(Index) * 2654435761u ) & ( ( UInt64(1) << Width ) - 1 );
+            Expected += Value;
+            for( UInt32 Bit = 0 ; Bit < Width ; ++Bit )
+                { Packed.put( static_cast<char>( ( Value >> Bit ) & 1 ) ); }
+        }
+        // Build the bytes by hand so this test doesn't depend on the writer.
+        const String Bits = Packed.str();
+        String Bytes( ( Bits.size() + 7 ) / 8,'\0' );
+        for( size_t Bit = 0 ; Bit < Bits.size() ; ++Bit )
+        {
+            Bytes[Bit / 8] = static_cast<char>( Bytes[Bit / 8] | ( Bits[Bit] << ( Bit % 8 ) ) );
+        }
+
+        StdInputStreamPtr TestStream = std::make_shared<std::istringstream>(Bytes);
+        BitStreamReader TestReader(TestStream);
+        UInt64 Actual = 0;
+        for( UInt32 Index = 0 ; Index < 500 ; ++Index )
+            { Actual += TestReader.ReadBits(Index % 13 + 1); }
+        TEST_EQUAL("ReadBits(const_UInt32)-MixedWidths",
+                   Expected,Actual)
+        TEST_EQUAL("ReadBits(const_UInt32)-MixedWidths-Valid",
+                   false,TestStream->fail())
+    }//RoundTrip
+}
+
+#endif // Mezz_IOStreams_BitStreamReaderTests_h
@@ -0,0 +1,97 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_BitStreamWriterTests_h
+#define Mezz_IOStreams_BitStreamWriterTests_h
+
+/// @file
+/// @brief This file tests the functionality of the BitStreamWriter class.
+
+#include "MezzTest.h"
+
+#include "BitStreamWriter.h"
+
+#include <sstream>
+
+AUTOMATIC_TEST_GROUP(BitStreamWriterTests,BitStreamWriter)
+{
+    using namespace Mezzanine;
+
+    {//Packing
+        std::shared_ptr<std::stringstream> TestStream = std::make_shared<std::stringstream>();
+        BitStreamWriter TestWriter(TestStream);
+        TEST_EQUAL("WriteBits(const_UInt64,const_UInt32)-Valid",
+                   true,TestWriter.WriteBits(0x5,3))
+        TestWriter.WriteBits(0xFF,2);
+        TestWriter.WriteBit(false);
+        TestWriter.WriteBit(true);
+        TEST_EQUAL("WriteBits(const_UInt64,const_UInt32)-Buffered",
+                   String(),TestStream->str())
+        TEST_EQUAL("GetBitsWritten()_const",
+                   UInt64(7),TestWriter.GetBitsWritten())
+
+        TEST_EQUAL("AlignToByte()-Valid",
+                   true,TestWriter.AlignToByte())
+        TEST_EQUAL("AlignToByte()-Value",
+                   String("\x5D",1),TestStream->str())
+        TEST_EQUAL("GetBitsWritten()_const-Aligned",
+                   UInt64(8),TestWriter.GetBitsWritten())
+
+        TestWriter.WriteBits(0x7FF,11);
+        TestWriter.AlignToByte();
+        TEST_EQUAL("WriteBits(const_UInt64,const_UInt32)-AcrossBytes",
+                   String("\x5D\xFF\x07",3),TestStream->str())
+    }//Packing
+
+    {//Words
+        std::shared_ptr<std::stringstream> TestStream = std::make_shared<std::stringstream>();
+        {
+            BitStreamWriter TestWriter(TestStream);
+            TestWriter.WriteBits(0x1,4);
+            TestWriter.WriteBits(0x0123456789ABCDEF,64);
+            TEST_EQUAL("WriteBits(const_UInt64,const_UInt32)-FullWord",
+                       size_t(8),TestStream->str().size())
+            TestWriter.WriteBits(0,0);
+        }
+        TEST_EQUAL("~BitStreamWriter()-Flushed",
+                   String("\xF1\xDE\xBC\x9A\x78\x56\x34\x12\x00",9),TestStream->str())
+    }//Words
+}
+
+#endif // Mezz_IOStreams_BitStreamWriterTests_h
@@ -0,0 +1,168 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_BufferPoolTests_h
+#define Mezz_IOStreams_BufferPoolTests_h
+
+/// @file
+/// @brief This file tests the functionality of the BufferPool class.
+
+#include "MezzTest.h"
+
+#include "BufferPool.h"
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
+/// @brief Uses the pool from its destructor, which runs during thread exit after the thread cache is gone.
+struct BufferPoolExitUser
+{
+    /// @brief Set to the number of bytes that could be written to the buffer acquired during destruction.
+    size_t* Result = nullptr;
+
+    /// @brief Class destructor.
+    ~BufferPoolExitUser()
+    {
+        Mezzanine::BufferPool::BufferPtr Buffer = Mezzanine::BufferPool::Acquire(100);
+        std::fill(Buffer.get(),Buffer.get() + 100,'x');
+        *( this->Result ) = static_cast<size_t>( std::count(Buffer.get(),Buffer.get() + 100,'x') );
+    }
+};//BufferPoolExitUser
+
+AUTOMATIC_TEST_GROUP(BufferPoolTests,BufferPool)
+{
+    using namespace Mezzanine;
+
+    {//Capacity
+        TEST_EQUAL("GetCapacity(const_size_t)-Tiny",
+                   size_t(256),BufferPool::GetCapacity(1))
+        TEST_EQUAL("GetCapacity(const_size_t)-Exact",
+                   size_t(4096),BufferPool::GetCapacity(4096))
+        TEST_EQUAL("GetCapacity(const_size_t)-RoundedUp",
+                   size_t(8192),BufferPool::GetCapacity(4097))
+        TEST_EQUAL("GetCapacity(const_size_t)-Largest",
+                   BufferPool::MaxPooledSize,BufferPool::GetCapacity(BufferPool::MaxPooledSize))
+        TEST_EQUAL("GetCapacity(const_size_t)-Unpooled",
+                   BufferPool::MaxPooledSize + 1,BufferPool::GetCapacity(BufferPool::MaxPooledSize + 1))
+    }//Capacity
+
+    {//ThreadCache
+        BufferPool::Trim();
+        Char8* FirstAddress = nullptr;
+        {
+            BufferPool::BufferPtr First = BufferPool::Acquire(1000);
+            FirstAddress = First.get();
+            First[999] = 'A';
+        }
+        TEST_EQUAL("Acquire(const_size_t)-ReleasedToThread",
+                   size_t(1),BufferPool::GetThreadCachedCount(1000))
+        TEST_EQUAL("Acquire(const_size_t)-SameClassReused",
+                   true,FirstAddress == BufferPool::Acquire(1024).get())
+        TEST_EQUAL("Acquire(const_size_t)-OtherClassNotReused",
+                   true,FirstAddress != BufferPool::Acquire(2000).get())
+
+        std::vector<BufferPool::BufferPtr> Many;
+        for( size_t Count = 0 ; Count < BufferPool::ThreadCacheDepth + 3 ; ++Count )
+            { Many.push_back( BufferPool::Acquire(300) ); }
+        Many.clear();
+        TEST_EQUAL("GetThreadCachedCount(const_size_t)-Full",
+                   BufferPool::ThreadCacheDepth,BufferPool::GetThreadCachedCount(300))
+        TEST_EQUAL("GetSharedCachedCount(const_size_t)-Overflow",
+                   size_t(3),BufferPool::GetSharedCachedCount(300))
+
+        BufferPool::Trim();
+        TEST_EQUAL("Trim()-Thread",
+                   size_t(0),BufferPool::GetThreadCachedCount(300))
+        TEST_EQUAL("Trim()-Shared",
+                   size_t(0),BufferPool::GetSharedCachedCount(300))
+    }//ThreadCache
+
+    {//SharedCache
+        BufferPool::Trim();
+        BufferPool::BufferPtr Large = BufferPool::Acquire(256 * 1024);
+        Char8* LargeAddress = Large.get();
+        Large.reset();
+        TEST_EQUAL("Acquire(const_size_t)-LargeSkipsThreadCache",
+                   size_t(0),BufferPool::GetThreadCachedCount(256 * 1024))
+        TEST_EQUAL("Acquire(const_size_t)-LargeToShared",
+                   size_t(1),BufferPool::GetSharedCachedCount(256 * 1024))
+
+        Char8* OtherThreadAddress = nullptr;
+        std::thread OtherThread([&OtherThreadAddress](){
+            OtherThreadAddress = BufferPool::Acquire(256 * 1024).get();
+        });
+        OtherThread.join();
+        TEST_EQUAL("Acquire(const_size_t)-SharedAcrossThreads",
+                   true,LargeAddress == OtherThreadAddress)
+
+        // Constructed before the thread cache, so it is destroyed after it.
+        size_t ExitResult = 0;
+        std::thread ExitingThread([&ExitResult](){
+            thread_local BufferPoolExitUser ExitUser;
+            ExitUser.Result = &ExitResult;
+            BufferPool::Acquire(100).reset();
+        });
+        ExitingThread.join();
+        TEST_EQUAL("Acquire(const_size_t)-AfterThreadCacheDestroyed",
+                   size_t(100),ExitResult)
+
+        BufferPool::Trim();
+        BufferPool::BufferPtr Huge = BufferPool::Acquire(BufferPool::MaxPooledSize + 1);
+        Huge.reset();
+        TEST_EQUAL("Acquire(const_size_t)-UnpooledFreed",
+                   size_t(0),BufferPool::GetSharedCachedCount(BufferPool::MaxPooledSize))
+    }//SharedCache
+
+    {//Allocator
+        BufferPool::Trim();
+        std::shared_ptr<UInt64> Pooled = MakePooledShared<UInt64>(UInt64(42));
+        TEST_EQUAL("MakePooledShared(ArgTypes&&...)-Value",
+                   UInt64(42),*Pooled)
+        Pooled.reset();
+        TEST_EQUAL("MakePooledShared(ArgTypes&&...)-Released",
+                   size_t(1),BufferPool::GetThreadCachedCount(BufferPool::MinPooledSize))
+
+        std::vector<UInt32,BufferPoolAllocator<UInt32>> PooledVector(100,UInt32(7));
+        TEST_EQUAL("BufferPoolAllocator-Vector",
+                   UInt32(700),std::accumulate(PooledVector.begin(),PooledVector.end(),UInt32(0)))
+    }//Allocator
+}
+
+#endif // Mezz_IOStreams_BufferPoolTests_h
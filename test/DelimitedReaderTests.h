@@ -0,0 +1,197 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_DelimitedReaderTests_h
+#define Mezz_IOStreams_DelimitedReaderTests_h
+
+/// @file
+/// @brief This file tests the functionality of the DelimitedReader class.
+
+#include "MezzTest.h"
+
+#include "DelimitedReader.h"
+#include "SegmentedMemoryStream.h"
+
+#include <sstream>
+#include <vector>
+
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+/// @brief A streambuf that hands out its data a byte at a time without a buffer.
+class DelimitedReaderUnbufferedBuffer : public std::streambuf
+{
+protected:
+    /// @brief The data to hand out.
+    Mezzanine::String Data;
+    /// @brief The number of bytes handed out so far.
+    size_t Position = 0;
+
+    /// @brief Peeks at the next character.
+    /// @return Returns the next character, or eof when all data has been handed out.
+    int_type underflow() override
+    {
+        if( this->Position >= this->Data.size() ) {
+            return traits_type::eof();
+        }
+        return traits_type::to_int_type(this->Data[this->Position]);
+    }
+    /// @brief Hands out the next character.
+    /// @return Returns the next character, or eof when all data has been handed out.
+    int_type uflow() override
+    {
+        if( this->Position >= this->Data.size() ) {
+            return traits_type::eof();
+        }
+        return traits_type::to_int_type(this->Data[this->Position++]);
+    }
+public:
+    /// @brief Class constructor.
+    /// @param ToHandOut The data to hand out.
+    DelimitedReaderUnbufferedBuffer(const Mezzanine::String& ToHandOut) :
+        Data(ToHandOut)
+        {  }
+};//DelimitedReaderUnbufferedBuffer
+RESTORE_WARNING_STATE
+
+AUTOMATIC_TEST_GROUP(DelimitedReaderTests,DelimitedReader)
+{
+    using namespace Mezzanine;
+
+    // Quoted fields with delimiters, newlines and doubled quotes, a CRLF ending, an empty field and a last
+    // record without a newline. The long record is wider than a classification block.
+    const String TestBuffer = "id,name,notes\n"
+                              "1,\"Smith, John\",plain\r\n"
+                              "2,\"say \"\"hi\"\"\",\"two\nlines\"\n"
+                              "3,,\"\"\n"
+                              "4,abcdefghijklmnopqrstuvwxyz,\"ABCDEFGHIJKLMNOPQRSTUVWXYZ,0123456789\",abcdefghijklmnopqrstuvwxyz\n"
+                              "5;semi;colon";
+    const std::vector< std::vector<String> > Expected = {
+        { "id", "name", "notes" },
+        { "1", "Smith, John", "plain" },
+        { "2", "say \"hi\"", "two\nlines" },
+        { "3", "", "" },
+        { "4", "abcdefghijklmnopqrstuvwxyz", "ABCDEFGHIJKLMNOPQRSTUVWXYZ,0123456789", "abcdefghijklmnopqrstuvwxyz" },
+        { "5;semi;colon" }
+    };
+
+    // Reads every record and compares the fields against what was expected.
+    auto ReadsAll = [&Expected](StdInputStreamPtr Input) -> Boole {
+        DelimitedReader Reader(Input);
+        std::vector<StringView> Fields;
+        for( const std::vector<String>& Record : Expected )
+        {
+            if( !Reader.ReadRecord(Fields) || Fields.size() != Record.size() ) {
+                return false;
+            }
+            for( size_t Index = 0 ; Index < Record.size() ; ++Index )
+            {
+                if( Fields[Index] != Record[Index] ) {
+                    return false;
+                }
+            }
+        }
+        return !Reader.ReadRecord(Fields) && Fields.empty() && Input->eof();
+    };
+
+    {//Basics
+        DelimitedReader DefaultReader(std::make_shared<std::istringstream>(TestBuffer));
+        TEST_EQUAL("GetDelimiter()_const",
+                   ',',DefaultReader.GetDelimiter())
+        TEST_EQUAL("GetQuote()_const",
+                   '"',DefaultReader.GetQuote())
+
+        StdInputStreamPtr SemicolonStream = std::make_shared<std::istringstream>("a;'b;c';'it''s'\n");
+        DelimitedReader SemicolonReader(SemicolonStream,';','\'');
+        std::vector<StringView> Fields;
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-CustomCharacters-Read",
+                   true,SemicolonReader.ReadRecord(Fields))
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-CustomCharacters-Count",
+                   size_t(3),Fields.size())
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-CustomCharacters-Quoted",
+                   StringView("b;c"),Fields[1])
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-CustomCharacters-Escaped",
+                   StringView("it's"),Fields[2])
+
+        StdInputStreamPtr EmptyStream = std::make_shared<std::istringstream>("");
+        DelimitedReader EmptyReader(EmptyStream);
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-Empty",
+                   false,EmptyReader.ReadRecord(Fields))
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-Empty-Failed",
+                   true,EmptyStream->fail())
+    }//Basics
+
+    {//Records
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-Buffered",
+                   true,ReadsAll(std::make_shared<std::istringstream>(TestBuffer)))
+
+        std::shared_ptr<SegmentedMemoryStream> SegmentedStream = std::make_shared<SegmentedMemoryStream>(16);
+        SegmentedStream->write(TestBuffer.data(),static_cast<StreamSize>( TestBuffer.size() ));
+        SegmentedStream->seekg(0);
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-Segmented",
+                   true,ReadsAll(SegmentedStream))
+
+        DelimitedReaderUnbufferedBuffer UnbufferedBuffer(TestBuffer);
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-Unbuffered",
+                   true,ReadsAll(std::make_shared<std::istream>(&UnbufferedBuffer)))
+    }//Records
+
+    {//LongQuotes
+        // A quoted field spanning several blocks, with a delimiter and newline right at the block edges.
+        String LongField(63,'x');
+        LongField.append(",\n");
+        LongField.append(70,'y');
+        const String LongBuffer = "\"" + LongField + "\",tail\nnext\n";
+        StdInputStreamPtr LongStream = std::make_shared<std::istringstream>(LongBuffer);
+        DelimitedReader LongReader(LongStream);
+        std::vector<StringView> Fields;
+        LongReader.ReadRecord(Fields);
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-LongQuoted-Count",
+                   size_t(2),Fields.size())
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-LongQuoted-Field",
+                   StringView(LongField),Fields[0])
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-LongQuoted-Tail",
+                   StringView("tail"),Fields[1])
+        LongReader.ReadRecord(Fields);
+        TEST_EQUAL("ReadRecord(std::vector<StringView>&)-LongQuoted-Next",
+                   StringView("next"),Fields[0])
+    }//LongQuotes
+}
+
+#endif
@@ -0,0 +1,136 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_EndianToolsTests_h
+#define Mezz_IOStreams_EndianToolsTests_h
+
+/// @file
+/// @brief This file tests the functionality of the EndianTools utilities.
+
+#include "MezzTest.h"
+
+#include "EndianTools.h"
+
+#include <vector>
+
+AUTOMATIC_TEST_GROUP(EndianToolsTests,EndianTools)
+{
+    using namespace Mezzanine;
+
+    {//Scalar
+        TEST_EQUAL("ByteSwap(const_Datum)-UInt16",
+                   UInt16(0x3412),EndianTools::ByteSwap( UInt16(0x1234) ))
+        TEST_EQUAL("ByteSwap(const_Datum)-UInt32",
+                   UInt32(0x78563412),EndianTools::ByteSwap( UInt32(0x12345678) ))
+        TEST_EQUAL("ByteSwap(const_Datum)-UInt64",
+                   UInt64(0xEFCDAB8967452301),EndianTools::ByteSwap( UInt64(0x0123456789ABCDEF) ))
+        TEST_EQUAL("ByteSwap(const_Datum)-Int8",
+                   Int8(-5),EndianTools::ByteSwap( Int8(-5) ))
+        TEST_EQUAL_EPSILON("ByteSwap(const_Datum)-DoubleRoundTrip",
+                           1.2345,EndianTools::ByteSwap( EndianTools::ByteSwap(1.2345) ))
+
+        TEST_EQUAL("ConvertByteOrder(const_Datum,const_ByteOrder)-Native",
+                   UInt32(0x12345678),EndianTools::ConvertByteOrder(UInt32(0x12345678),ByteOrder::Native))
+        const ByteOrder Foreign = ( ByteOrder::Native == ByteOrder::Little ? ByteOrder::Big : ByteOrder::Little );
+        TEST_EQUAL("ConvertByteOrder(const_Datum,const_ByteOrder)-Foreign",
+                   UInt32(0x78563412),EndianTools::ConvertByteOrder(UInt32(0x12345678),Foreign))
+        TEST_EQUAL("NeedsSwap(const_ByteOrder)",
+                   true,EndianTools::NeedsSwap(Foreign))
+    }//Scalar
+
+    {//Arrays
+        // Sizes chosen to cover whole vector blocks, partial blocks and the scalar tail.
+        Boole AllMatched = true;
+        for( const size_t Count : { size_t(1), size_t(7), size_t(8), size_t(17), size_t(33), size_t(100) } )
+        {
+            std::vector<UInt16> Shorts(Count);
+            std::vector<UInt32> Ints(Count);
+            std::vector<UInt64> Longs(Count);
+            for( size_t Index = 0 ; Index < Count ; ++Index )
+            {
+                Shorts[Index] = static_cast<UInt16>( Index * 0x0102 + 0x0A0B );
+                Ints[Index] = static_cast<UInt32>( Index * 0x01020304 + 0x0A0B0C0D );
+                Longs[Index] = UInt64(Index) * 0x0102030405060708 + 0x0A0B0C0D0E0F1011;
+            }
+
+            std::vector<UInt16> SwappedShorts(Count);
+            EndianTools::ByteSwapCopy(SwappedShorts.data(),Shorts.data(),Count,sizeof(UInt16));
+            std::vector<UInt32> SwappedInts(Ints);
+            EndianTools::ByteSwapCopy(SwappedInts.data(),SwappedInts.data(),Count,sizeof(UInt32));
+            std::vector<UInt64> SwappedLongs(Longs);
+            EndianTools::ConvertArray(SwappedLongs.data(),Count,ByteOrder::Big);
+            EndianTools::ConvertArray(SwappedLongs.data(),Count,ByteOrder::Little);
+
+            for( size_t Index = 0 ; Index < Count ; ++Index )
+            {
+                AllMatched = AllMatched && SwappedShorts[Index] == EndianTools::ByteSwap(Shorts[Index]);
+                AllMatched = AllMatched && SwappedInts[Index] == EndianTools::ByteSwap(Ints[Index]);
+                AllMatched = AllMatched && SwappedLongs[Index] == EndianTools::ByteSwap(Longs[Index]);
+            }
+        }
+        TEST_EQUAL("ByteSwapCopy(void*,const_void*,const_size_t,const_size_t)",
+                   true,AllMatched)
+
+        std::vector<UInt32> Untouched = { 1, 2, 3 };
+        EndianTools::ConvertArray(Untouched.data(),Untouched.size(),ByteOrder::Native);
+        TEST_EQUAL("ConvertArray(Datum*,const_size_t,const_ByteOrder)-Native",
+                   UInt32(2),Untouched[1])
+    }//Arrays
+
+    {//PackedRecords
+        const size_t RecordSize = EndianTools::PackedSize<UInt8,UInt16,UInt32,double>;
+        TEST_EQUAL("PackedSize",
+                   size_t(15),RecordSize)
+        constexpr std::array<size_t,4> Offsets = EndianTools::PackedOffsets<UInt8,UInt16,UInt32,double>();
+        TEST_EQUAL("PackedOffsets()",
+                   true,Offsets[0] == 0 && Offsets[1] == 1 && Offsets[2] == 3 && Offsets[3] == 7)
+
+        char Packed[7] = {};
+        const std::tuple<UInt8,UInt16,UInt32> Fields(0x01,0x0203,0x04050607);
+        EndianTools::PackTuple(Packed,Fields,ByteOrder::Little,std::index_sequence_for<UInt8,UInt16,UInt32>());
+        TEST_EQUAL("PackTuple(char*,const_std::tuple<Data...>&,const_ByteOrder,std::index_sequence)",
+                   String("\x01\x03\x02\x07\x06\x05\x04",7),String(Packed,7))
+        const std::tuple<UInt8,UInt16,UInt32> Unpacked =
+            EndianTools::UnpackTuple<UInt8,UInt16,UInt32>(Packed,ByteOrder::Little,std::index_sequence_for<UInt8,UInt16,UInt32>());
+        TEST_EQUAL("UnpackTuple(const_char*,const_ByteOrder,std::index_sequence)",
+                   true,Fields == Unpacked)
+    }//PackedRecords
+}
+
+#endif // Mezz_IOStreams_EndianToolsTests_h
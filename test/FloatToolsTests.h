@@ -0,0 +1,141 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_FloatToolsTests_h
+#define Mezz_IOStreams_FloatToolsTests_h
+
+/// @file
+/// @brief This file tests the functionality of the FloatTools utilities.
+
+#include "MezzTest.h"
+
+#include "FloatTools.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+AUTOMATIC_TEST_GROUP(FloatToolsTests,FloatTools)
+{
+    using namespace Mezzanine;
+
+    {//Half
+        TEST_EQUAL("FloatToHalf(const_float)-One",
+                   UInt16(0x3C00),FloatTools::FloatToHalf(1.0f))
+        TEST_EQUAL("FloatToHalf(const_float)-NegativeTwo",
+                   UInt16(0xC000),FloatTools::FloatToHalf(-2.0f))
+        TEST_EQUAL("FloatToHalf(const_float)-Max",
+                   UInt16(0x7BFF),FloatTools::FloatToHalf(65504.0f))
+        TEST_EQUAL("FloatToHalf(const_float)-Overflow",
+                   UInt16(0x7C00),FloatTools::FloatToHalf(65520.0f))
+        TEST_EQUAL("FloatToHalf(const_float)-SmallestSubnormal",
+                   UInt16(0x0001),FloatTools::FloatToHalf(5.9604645e-8f))
+        TEST_EQUAL("FloatToHalf(const_float)-Underflow",
+                   UInt16(0x8000),FloatTools::FloatToHalf(-1e-9f))
+        TEST_EQUAL("FloatToHalf(const_float)-RoundToEven",
+                   UInt16(0x3C00),FloatTools::FloatToHalf(1.0f + 1.0f / 2048.0f))
+        TEST_EQUAL("FloatToHalf(const_float)-NaN",
+                   true,( FloatTools::FloatToHalf( std::numeric_limits<float>::quiet_NaN() ) & 0x7FFF ) > 0x7C00)
+
+        TEST_EQUAL("HalfToFloat(const_UInt16)-One",
+                   1.0f,FloatTools::HalfToFloat(0x3C00))
+        TEST_EQUAL("HalfToFloat(const_UInt16)-Subnormal",
+                   5.9604645e-8f,FloatTools::HalfToFloat(0x0001))
+        TEST_EQUAL("HalfToFloat(const_UInt16)-NegativeZero",
+                   true,std::signbit( FloatTools::HalfToFloat(0x8000) ))
+        TEST_EQUAL("HalfToFloat(const_UInt16)-Infinity",
+                   std::numeric_limits<float>::infinity(),FloatTools::HalfToFloat(0x7C00))
+
+        Boole AllMatched = true;
+        for( UInt32 Half = 0 ; Half < 0x10000 ; ++Half )
+        {
+            if( ( Half & 0x7C00 ) == 0x7C00 && ( Half & 0x03FF ) != 0 ) {
+                continue;
+            }
+            const UInt16 Bits = static_cast<UInt16>(Half);
+            AllMatched = AllMatched && FloatTools::FloatToHalf( FloatTools::HalfToFloat(Bits) ) == Bits;
+        }
+        TEST_EQUAL("HalfToFloat(const_UInt16)-RoundTrip",
+                   true,AllMatched)
+    }//Half
+
+    {//Arrays
+        std::vector<float> Values(37);
+        for( size_t Index = 0 ; Index < Values.size() ; ++Index )
+            { Values[Index] = static_cast<float>(Index) / 18.0f - 1.0f; }
+
+        std::vector<UInt16> Halves(Values.size());
+        std::vector<float> Decoded(Values.size());
+        FloatTools::EncodeFloats(Values.data(),Values.size(),FloatEncoding::Half,Halves.data());
+        FloatTools::DecodeFloats(Halves.data(),Halves.size(),FloatEncoding::Half,Decoded.data());
+        Boole AllMatched = true;
+        for( size_t Index = 0 ; Index < Values.size() ; ++Index )
+        {
+            AllMatched = AllMatched && Halves[Index] == FloatTools::FloatToHalf(Values[Index]);
+            AllMatched = AllMatched && std::abs(Decoded[Index] - Values[Index]) < 0.001f;
+        }
+        TEST_EQUAL("EncodeFloats(const_float*,const_size_t,const_FloatEncoding,void*)-Half",
+                   true,AllMatched)
+
+        const float Edges[6] = { -2.0f, -1.0f, 0.0f, 0.5f, 1.0f, std::numeric_limits<float>::quiet_NaN() };
+        Int8 SNorm8[6] = {};
+        FloatTools::EncodeFloats(Edges,6,FloatEncoding::SNorm8,SNorm8);
+        TEST_EQUAL("EncodeFloats(const_float*,const_size_t,const_FloatEncoding,void*)-SNorm8",
+                   true,SNorm8[0] == -127 && SNorm8[1] == -127 && SNorm8[2] == 0 &&
+                        SNorm8[3] == 64 && SNorm8[4] == 127 && SNorm8[5] == 0)
+        UInt16 UNorm16[6] = {};
+        FloatTools::EncodeFloats(Edges,6,FloatEncoding::UNorm16,UNorm16);
+        TEST_EQUAL("EncodeFloats(const_float*,const_size_t,const_FloatEncoding,void*)-UNorm16",
+                   true,UNorm16[0] == 0 && UNorm16[2] == 0 && UNorm16[3] == 32768 &&
+                        UNorm16[4] == 65535 && UNorm16[5] == 0)
+
+        const Int8 Smallest[2] = { -128, 127 };
+        float SNormDecoded[2] = {};
+        FloatTools::DecodeFloats(Smallest,2,FloatEncoding::SNorm8,SNormDecoded);
+        TEST_EQUAL("DecodeFloats(const_void*,const_size_t,const_FloatEncoding,float*)-SNorm8",
+                   true,SNormDecoded[0] == -1.0f && SNormDecoded[1] == 1.0f)
+        const UInt8 Bytes[2] = { 0, 255 };
+        float UNormDecoded[2] = {};
+        FloatTools::DecodeFloats(Bytes,2,FloatEncoding::UNorm8,UNormDecoded);
+        TEST_EQUAL("DecodeFloats(const_void*,const_size_t,const_FloatEncoding,float*)-UNorm8",
+                   true,UNormDecoded[0] == 0.0f && UNormDecoded[1] == 1.0f)
+    }//Arrays
+}
+
+#endif // Mezz_IOStreams_FloatToolsTests_h
@@ -0,0 +1,353 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_InputStreamTests_h
+#define Mezz_IOStreams_InputStreamTests_h
+
+/// @file
+/// @brief This file tests the functionality of the InputStream class.
+
+#include "MezzTest.h"
+
+#include "InputStream.h"
+#include "StreamTools.h"
+
+#include <thread>
+
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+SUPPRESS_CLANG_WARNING("-Wpadded")
+/// @brief A streambuf that only exposes a few bytes of a String at a time, like a file buffer would.
+class InputStreamTestBuffer : public std::streambuf
+{
+protected:
+    /// @brief The data being streamed.
+    Mezzanine::String Source;
+    /// @brief The number of bytes to expose in the get area at a time.
+    std::ptrdiff_t ChunkSize;
+    /// @brief Whether or not seeking is permitted on this buffer.
+    bool Seekable;
+
+    /// @brief Exposes the chunk containing a position as the get area.
+    /// @param Position The position in the Source to expose.
+    void SetChunk(const std::ptrdiff_t Position)
+    {
+        char* Begin = &this->Source[0];
+        std::ptrdiff_t End = std::min(Position + this->ChunkSize,static_cast<std::ptrdiff_t>(this->Source.size()));
+        this->setg(Begin + Position,Begin + Position,Begin + End);
+    }
+public:
+    /// @brief Class constructor.
+    /// @param Data The data to be streamed.
+    /// @param Chunk The number of bytes to expose in the get area at a time.
+    /// @param CanSeek Whether or not seeking is permitted on this buffer.
+    InputStreamTestBuffer(const Mezzanine::String& Data, const std::ptrdiff_t Chunk, const bool CanSeek) :
+        Source(Data),
+        ChunkSize(Chunk),
+        Seekable(CanSeek)
+        { this->SetChunk(0); }
+    ~InputStreamTestBuffer() = default;
+
+    int_type underflow() override
+    {
+        std::ptrdiff_t Position = this->egptr() - &this->Source[0];
+        if( Position >= static_cast<std::ptrdiff_t>(this->Source.size()) ) {
+            return traits_type::eof();
+        }
+        this->SetChunk(Position);
+        return traits_type::to_int_type(*this->gptr());
+    }
+    pos_type seekoff(off_type Offset, std::ios_base::seekdir Origin, std::ios_base::openmode) override
+    {
+        if( !this->Seekable ) {
+            return pos_type(off_type(-1));
+        }
+        off_type Current = this->gptr() - &this->Source[0];
+        off_type Target = ( Origin == std::ios_base::beg ? Offset :
+                            Origin == std::ios_base::cur ? Current + Offset :
+                                                           static_cast<off_type>(this->Source.size()) + Offset );
+        if( Target < 0 || Target > static_cast<off_type>(this->Source.size()) ) {
+            return pos_type(off_type(-1));
+        }
+        this->SetChunk(static_cast<std::ptrdiff_t>(Target));
+        return pos_type(Target);
+    }
+    pos_type seekpos(pos_type Position, std::ios_base::openmode Mode) override
+        { return this->seekoff(off_type(Position),std::ios_base::beg,Mode); }
+};//InputStreamTestBuffer
+
+/// @brief A buffer that can only seek forward, so positions can't be restored after reading past them.
+class InputStreamForwardSeekBuffer : public InputStreamTestBuffer
+{
+public:
+    /// @brief Class constructor.
+    /// @param Data The data to be streamed.
+    /// @param Chunk The number of bytes to expose in the get area at a time.
+    InputStreamForwardSeekBuffer(const Mezzanine::String& Data, const std::ptrdiff_t Chunk) :
+        InputStreamTestBuffer(Data,Chunk,true)
+        {  }
+
+    pos_type seekpos(pos_type Position, std::ios_base::openmode Mode) override
+    {
+        if( off_type(Position) < this->gptr() - &this->Source[0] ) {
+            return pos_type(off_type(-1));
+        }
+        return this->seekoff(off_type(Position),std::ios_base::beg,Mode);
+    }
+};//InputStreamForwardSeekBuffer
+
+/// @brief A minimal concrete InputStream to test the methods implemented by InputStream.
+class InputStreamTestStream : public Mezzanine::InputStream
+{
+protected:
+    /// @brief The buffer being streamed.
+    InputStreamTestBuffer TestBuffer;
+public:
+    /// @brief Class constructor.
+    /// @param Data The data to be streamed.
+    /// @param Chunk The number of bytes to expose in the get area at a time.
+    /// @param CanSeek Whether or not seeking is permitted on this Stream.
+    InputStreamTestStream(const Mezzanine::String& Data, const std::ptrdiff_t Chunk, const bool CanSeek) :
+        InputStream(&TestBuffer),
+        TestBuffer(Data,Chunk,CanSeek)
+        {  }
+    ~InputStreamTestStream() = default;
+
+    Mezzanine::String GetIdentifier() const override
+        { return "InputStreamTestStream"; }
+    Mezzanine::String GetGroup() const override
+        { return Mezzanine::String(); }
+    Mezzanine::StreamSize GetSize() const override
+        { return -1; }
+    Mezzanine::Boole CanSeek() const override
+        { return false; }
+    Mezzanine::Boole IsEncrypted() const override
+        { return false; }
+    Mezzanine::Boole IsRaw() const override
+        { return true; }
+};//InputStreamTestStream
+RESTORE_WARNING_STATE
+
+AUTOMATIC_TEST_GROUP(InputStreamTests,InputStream)
+{
+    using namespace Mezzanine;
+
+    // Set everything up for our test.
+    // Poem from: https://www.poetrysoup.com/poem/will_you_slumber_on_823149
+    const String TestBuffer = "When the moon retires its gleam,\n"  //33
+                              "And sunlight shines upon the dew,\n" //34
+                              "Do you rise from bed anew?\n"        //27
+                              "Or slumber on in a waking dream..."; //34
+
+    {//Views
+        InputStreamTestStream TestStream(TestBuffer,16,true);
+
+        StringView FirstPeek = TestStream.Peek(4);
+        TEST_EQUAL("Peek(const_StreamSize)-Contiguous-Value",
+                   StringView("When"),FirstPeek)
+        TEST_EQUAL("Peek(const_StreamSize)-Contiguous-Position",
+                   StreamPos(0),TestStream.GetReadPosition())
+        TEST_EQUAL("Consume(const_StreamSize)-Contiguous",
+                   StreamSize(5),TestStream.Consume(5))
+
+        StringView SecondPeek = TestStream.Peek(20);
+        TEST_EQUAL("Peek(const_StreamSize)-Straddle-Value",
+                   StringView("the moon retires its"),SecondPeek)
+        TEST_EQUAL("Peek(const_StreamSize)-Straddle-Position",
+                   StreamPos(5),TestStream.GetReadPosition())
+        TEST_EQUAL("Consume(const_StreamSize)-Straddle",
+                   StreamSize(28),TestStream.Consume(28))
+
+        StringView FirstAcquire = TestStream.Acquire(4);
+        TEST_EQUAL("Acquire(const_StreamSize)-Contiguous-Value",
+                   StringView("And "),FirstAcquire)
+        StringView SecondAcquire = TestStream.Acquire(29);
+        TEST_EQUAL("Acquire(const_StreamSize)-Straddle-Value",
+                   StringView("sunlight shines upon the dew,"),SecondAcquire)
+        TEST_EQUAL("Acquire(const_StreamSize)-Straddle-Position",
+                   StreamPos(66),TestStream.GetReadPosition())
+
+        TestStream.SetReadPosition(StreamPos(111));
+        StringView ShortAcquire = TestStream.Acquire(32);
+        TEST_EQUAL("Acquire(const_StreamSize)-Short-Value",
+                   StringView("a waking dream..."),ShortAcquire)
+        TEST_EQUAL("Acquire(const_StreamSize)-Short-EoF",
+                   true,TestStream.EoF())
+        TEST_EQUAL("Peek(const_StreamSize)-AfterEoF",
+                   true,TestStream.Peek(4).empty())
+    }//Views
+
+    {//NonSeekableViews
+        InputStreamTestStream TestStream(TestBuffer,16,false);
+
+        StringView StraddlePeek = TestStream.Peek(20);
+        TEST_EQUAL("Peek(const_StreamSize)-NonSeekable-Value",
+                   StringView("When the moon re"),StraddlePeek)
+        StringView StraddleAcquire = TestStream.Acquire(20);
+        TEST_EQUAL("Acquire(const_StreamSize)-NonSeekable-Value",
+                   StringView("When the moon retire"),StraddleAcquire)
+        TEST_EQUAL("Consume(const_StreamSize)-NonSeekable",
+                   StreamSize(13),TestStream.Consume(13))
+        TEST_EQUAL("Peek(const_StreamSize)-NonSeekable-AfterConsume",
+                   StringView("And"),TestStream.Peek(3))
+    }//NonSeekableViews
+
+    {//ReadV
+        InputStreamTestStream TestStream(TestBuffer,16,true);
+        Char8 FirstBuffer[4] = {};
+        Char8 SecondBuffer[29] = {};
+        Char8 ThirdBuffer[64] = {};
+        StreamReadSegment Segments[3] = { { FirstBuffer, 4 }, { SecondBuffer, 29 }, { ThirdBuffer, 64 } };
+
+        TEST_EQUAL("ReadV(const_StreamReadSegment*,const_size_t)-Count",
+                   StreamSize(97),TestStream.ReadV(Segments,3))
+        TEST_EQUAL("ReadV(const_StreamReadSegment*,const_size_t)-First",
+                   String("When"),String(FirstBuffer,4))
+        TEST_EQUAL("ReadV(const_StreamReadSegment*,const_size_t)-Second",
+                   String(" the moon retires its gleam,\n"),String(SecondBuffer,29))
+        TEST_EQUAL("ReadV(const_StreamReadSegment*,const_size_t)-Third",
+                   TestBuffer.substr(33,64),String(ThirdBuffer,64))
+        TEST_EQUAL("ReadV(const_StreamReadSegment*,const_size_t)-GCount",
+                   std::streamsize(64),TestStream.gcount())
+
+        TEST_EQUAL("ReadV(const_StreamReadSegment*,const_size_t)-Short-Count",
+                   StreamSize(31),TestStream.ReadV(Segments + 1,2))
+        TEST_EQUAL("ReadV(const_StreamReadSegment*,const_size_t)-Short-EoF",
+                   true,TestStream.EoF())
+        TEST_EQUAL("ReadV(const_StreamReadSegment*,const_size_t)-Short-GCount",
+                   std::streamsize(2),TestStream.gcount())
+    }//ReadV
+
+    {//ReadAt
+        InputStreamTestStream TestStream(TestBuffer,16,true);
+        TestStream.SetReadPosition(StreamPos(9));
+
+        Char8 ReadBuffer[32] = {};
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-Count",
+                   StreamSize(26),TestStream.ReadAt(StreamPos(67),ReadBuffer,26))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-Value",
+                   String("Do you rise from bed anew?"),String(ReadBuffer,26))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-ReadPosition",
+                   StreamPos(9),TestStream.GetReadPosition())
+
+        std::vector<String> ThreadResults(8);
+        std::vector<std::thread> Readers;
+        for( size_t CurrThread = 0 ; CurrThread < ThreadResults.size() ; ++CurrThread )
+        {
+            Readers.emplace_back([&,CurrThread](){
+                String& Result = ThreadResults[CurrThread];
+                Result.resize(16);
+                for( size_t Repeat = 0 ; Repeat < 100 ; ++Repeat )
+                {
+                    const StreamPos Position( static_cast<StreamOff>(CurrThread * 16) );
+                    Result.resize( static_cast<size_t>( TestStream.ReadAt(Position,&Result[0],16) ) );
+                }
+            });
+        }
+        for( std::thread& Reader : Readers )
+            { Reader.join(); }
+
+        Boole AllMatched = true;
+        for( size_t CurrThread = 0 ; CurrThread < ThreadResults.size() ; ++CurrThread )
+        {
+            AllMatched = AllMatched && ( ThreadResults[CurrThread] == TestBuffer.substr(CurrThread * 16,16) );
+        }
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-Concurrent-Values",
+                   true,AllMatched)
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-Concurrent-ReadPosition",
+                   StreamPos(9),TestStream.GetReadPosition())
+
+        InputStreamForwardSeekBuffer ForwardBuffer(TestBuffer,16);
+        std::istream ForwardStream(&ForwardBuffer);
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-RestoreFailed-Count",
+                   StreamSize(0),StreamTools::ReadAt(ForwardStream,StreamPos(67),ReadBuffer,26))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-RestoreFailed-Bad",
+                   true,ForwardStream.bad())
+    }//ReadAt
+
+    {//ReadAsync
+        InputStreamTestStream TestStream(TestBuffer,16,true);
+        TestStream.SetReadPosition(StreamPos(5));
+
+        Char8 FirstBuffer[16] = {};
+        Char8 SecondBuffer[16] = {};
+        Char8 ThirdBuffer[16] = {};
+        std::future<StreamSize> FirstRead = TestStream.ReadAsync(StreamPos(33),FirstBuffer,16);
+        std::future<StreamSize> SecondRead = TestStream.ReadAsync(StreamPos(120),SecondBuffer,16);
+        std::future<StreamSize> ThirdRead = TestStream.ReadAsync(StreamPos(500),ThirdBuffer,16);
+
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-First-Count",
+                   StreamSize(16),FirstRead.get())
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-First-Value",
+                   String("And sunlight shi"),String(FirstBuffer,16))
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-Short-Count",
+                   StreamSize(8),SecondRead.get())
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-Short-Value",
+                   String("dream..."),String(SecondBuffer,8))
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-OutOfRange",
+                   StreamSize(0),ThirdRead.get())
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-ReadPosition",
+                   StreamPos(5),TestStream.GetReadPosition())
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-Valid",
+                   true,TestStream.IsValid())
+
+        // The generic fallback serializes positional reads with each other.
+        InputStreamTestStream SharedStream(TestBuffer,16,true);
+        SharedStream.SetReadPosition(StreamPos(3));
+        std::vector<String> AsyncResults(64,String(16,'\0'));
+        std::vector< std::future<StreamSize> > Pending;
+        for( size_t CurrRead = 0 ; CurrRead < AsyncResults.size() ; ++CurrRead )
+        {
+            const StreamPos Position( static_cast<StreamOff>( ( CurrRead % 7 ) * 16 ) );
+            Pending.push_back( SharedStream.ReadAsync(Position,&AsyncResults[CurrRead][0],16) );
+        }
+        Boole AsyncMatched = true;
+        for( size_t CurrRead = 0 ; CurrRead < AsyncResults.size() ; ++CurrRead )
+        {
+            AsyncMatched = AsyncMatched && Pending[CurrRead].get() == 16 &&
+                           AsyncResults[CurrRead] == TestBuffer.substr( ( CurrRead % 7 ) * 16,16 );
+        }
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-Concurrent-Values",
+                   true,AsyncMatched)
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-Concurrent-Position",
+                   StreamPos(3),SharedStream.GetReadPosition())
+    }//ReadAsync
+}
+
+#endif // Mezz_IOStreams_InputStreamTests_h
@@ -0,0 +1,168 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_MemoryMappedStreamTests_h
+#define Mezz_IOStreams_MemoryMappedStreamTests_h
+
+/// @file
+/// @brief This file tests the functionality of the MemoryMappedInputStream class.
+
+#include "MezzTest.h"
+
+#include "MemoryMappedStream.h"
+
+#include <cstdio>
+
+AUTOMATIC_TEST_GROUP(MemoryMappedStreamTests,MemoryMappedStream)
+{
+    using namespace Mezzanine;
+
+    // Set everything up for our test.
+    // Poem from: https://www.poetrysoup.com/poem/will_you_slumber_on_823149
+    const String TestFileName = "MemoryMappedStreamTests.txt";
+    const String TestBuffer = "When the moon retires its gleam,\n"  //33
+                              "And sunlight shines upon the dew,\n" //34
+                              "Do you rise from bed anew?\n"        //27
+                              "Or slumber on in a waking dream..."; //34
+    {
+        std::ofstream TestFile(TestFileName,std::ios::out | std::ios::binary | std::ios::trunc);
+        TestFile.write(TestBuffer.data(),static_cast<StreamSize>(TestBuffer.size()));
+    }
+
+    {//Opening
+        MemoryMappedInputStream MissingStream("ZZZ_NoSuchFile.txt.bad");
+        TEST_EQUAL("IsOpen()_const-MissingFile",
+                   false,MissingStream.IsOpen())
+        TEST_EQUAL("Fail()_const-MissingFile",
+                   true,MissingStream.Fail())
+
+        MemoryMappedInputStream TestStream(TestFileName);
+        TEST_EQUAL("IsOpen()_const-TestFile",
+                   true,TestStream.IsOpen())
+        TEST_EQUAL("IsValid()_const-TestFile",
+                   true,TestStream.IsValid())
+        TEST_EQUAL("GetIdentifier()_const",
+                   TestFileName,TestStream.GetIdentifier())
+        TEST_EQUAL("GetSize()_const",
+                   StreamSize(128),TestStream.GetSize())
+        TEST_EQUAL("GetData()_const",
+                   TestBuffer,String(TestStream.GetData(),static_cast<size_t>(TestStream.GetSize())))
+
+        TestStream.CloseFile();
+        TEST_EQUAL("CloseFile()-IsOpen",
+                   false,TestStream.IsOpen())
+        TEST_EQUAL("CloseFile()-GetSize",
+                   StreamSize(0),TestStream.GetSize())
+    }//Opening
+
+    {//Reading
+        MemoryMappedInputStream TestStream(TestFileName);
+        Char8 ReadBuffer[64] = {};
+
+        TEST_EQUAL("Read(void*,const_StreamSize)-First-Count",
+                   size_t(14),TestStream.Read(ReadBuffer,14))
+        TEST_EQUAL("Read(void*,const_StreamSize)-First-Value",
+                   String("When the moon "),String(ReadBuffer,14))
+        TEST_EQUAL("GetReadPosition()-First",
+                   StreamPos(14),TestStream.GetReadPosition())
+
+        TestStream.SetReadPosition(StreamPos(67));
+        TEST_EQUAL("SetReadPosition(StreamPos)",
+                   StreamPos(67),TestStream.GetReadPosition())
+        TEST_EQUAL("ReadLine(Char8*,const_StreamSize,const_Char8)-Count",
+                   size_t(27),TestStream.ReadLine(ReadBuffer,64))
+        TEST_EQUAL("ReadLine(Char8*,const_StreamSize,const_Char8)-Value",
+                   String("Do you rise from bed anew?"),String(ReadBuffer))
+
+        TestStream.SetReadPosition(-17,SeekOrigin::End);
+        TEST_EQUAL("SetReadPosition(StreamOff,SeekOrigin)-End",
+                   StreamPos(111),TestStream.GetReadPosition())
+        TestStream.SetReadPosition(-6,SeekOrigin::Current);
+        TEST_EQUAL("SetReadPosition(StreamOff,SeekOrigin)-Current",
+                   StreamPos(105),TestStream.GetReadPosition())
+
+        TEST_EQUAL("Read(void*,const_StreamSize)-Short-Count",
+                   size_t(23),TestStream.Read(ReadBuffer,64))
+        TEST_EQUAL("Read(void*,const_StreamSize)-Short-Value",
+                   String("in a waking dream..."),String(ReadBuffer + 3,20))
+        TEST_EQUAL("EoF()_const",
+                   true,TestStream.EoF())
+
+        TestStream.ClearErrors();
+        TestStream.SetReadPosition(StreamPos(500));
+        TEST_EQUAL("SetReadPosition(StreamPos)-OutOfRange",
+                   true,TestStream.Fail())
+    }//Reading
+
+    {//ReadAt
+        MemoryMappedInputStream TestStream(TestFileName);
+        TestStream.SetReadPosition(StreamPos(33));
+
+        Char8 ReadBuffer[16] = {};
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-Count",
+                   StreamSize(9),TestStream.ReadAt(StreamPos(4),ReadBuffer,9))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-Value",
+                   String(" the moon"),String(ReadBuffer,9))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-End",
+                   StreamSize(0),TestStream.ReadAt(StreamPos(128),ReadBuffer,16))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-ReadPosition",
+                   StreamPos(33),TestStream.GetReadPosition())
+    }//ReadAt
+
+    {//ReadAsync
+        MemoryMappedInputStream TestStream(TestFileName);
+        Char8 FirstBuffer[16] = {};
+        Char8 SecondBuffer[16] = {};
+        std::future<StreamSize> FirstRead = TestStream.ReadAsync(StreamPos(94),FirstBuffer,16);
+        std::future<StreamSize> SecondRead = TestStream.ReadAsync(StreamPos(120),SecondBuffer,16);
+
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-First-Count",
+                   StreamSize(16),FirstRead.get())
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-First-Value",
+                   String("Or slumber on in"),String(FirstBuffer,16))
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-Short-Count",
+                   StreamSize(8),SecondRead.get())
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-ReadPosition",
+                   StreamPos(0),TestStream.GetReadPosition())
+    }//ReadAsync
+
+    std::remove(TestFileName.c_str());
+}
+
+#endif // Mezz_IOStreams_MemoryMappedStreamTests_h
@@ -0,0 +1,158 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_OutputStreamTests_h
+#define Mezz_IOStreams_OutputStreamTests_h
+
+/// @file
+/// @brief This file tests the functionality of the OutputStream class.
+
+#include "MezzTest.h"
+
+#include "OutputStream.h"
+#include "StreamTools.h"
+
+#include <stdexcept>
+
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+SUPPRESS_CLANG_WARNING("-Wpadded")
+/// @brief A minimal concrete OutputStream to test the methods implemented by OutputStream.
+class OutputStreamTestStream : public Mezzanine::OutputStream
+{
+protected:
+    /// @brief The buffer being streamed to.
+    std::stringbuf TestBuffer;
+public:
+    /// @brief Class constructor.
+    OutputStreamTestStream() :
+        OutputStream(&TestBuffer),
+        TestBuffer(std::ios_base::out)
+        {  }
+    ~OutputStreamTestStream() = default;
+
+    /// @brief Gets everything written to this Stream.
+    /// @return Returns a String containing the contents of the buffer.
+    Mezzanine::String GetContents() const
+        { return this->TestBuffer.str(); }
+
+    Mezzanine::String GetIdentifier() const override
+        { return "OutputStreamTestStream"; }
+    Mezzanine::String GetGroup() const override
+        { return Mezzanine::String(); }
+    Mezzanine::StreamSize GetSize() const override
+        { return static_cast<Mezzanine::StreamSize>( this->TestBuffer.str().size() ); }
+    Mezzanine::Boole CanSeek() const override
+        { return true; }
+    Mezzanine::Boole IsEncrypted() const override
+        { return false; }
+    Mezzanine::Boole IsRaw() const override
+        { return true; }
+};//OutputStreamTestStream
+
+/// @brief A streambuf that throws whenever it is written to.
+class OutputStreamThrowingBuffer : public std::streambuf
+{
+public:
+    int_type overflow(int_type) override
+        { throw std::runtime_error("OutputStreamThrowingBuffer"); }
+};//OutputStreamThrowingBuffer
+RESTORE_WARNING_STATE
+
+AUTOMATIC_TEST_GROUP(OutputStreamTests,OutputStream)
+{
+    using namespace Mezzanine;
+
+    {//WriteV
+        OutputStreamTestStream TestStream;
+        const String Header = "<header>";
+        const String Body = "When the moon retires its gleam,";
+        const String Footer = "</header>";
+        StreamWriteSegment Segments[4] = { { Header.data(), 8 },
+                                           { nullptr, 0 },
+                                           { Body.data(), 32 },
+                                           { Footer.data(), 9 } };
+
+        TEST_EQUAL("WriteV(const_StreamWriteSegment*,const_size_t)-Valid",
+                   true,TestStream.WriteV(Segments,4))
+        TEST_EQUAL("WriteV(const_StreamWriteSegment*,const_size_t)-Value",
+                   Header + Body + Footer,TestStream.GetContents())
+        TEST_EQUAL("WriteV(const_StreamWriteSegment*,const_size_t)-Position",
+                   StreamPos(49),TestStream.GetWritePosition())
+
+        TestStream.setstate(std::ios_base::failbit);
+        TEST_EQUAL("WriteV(const_StreamWriteSegment*,const_size_t)-Invalid",
+                   false,TestStream.WriteV(Segments,1))
+        TEST_EQUAL("WriteV(const_StreamWriteSegment*,const_size_t)-Invalid-Value",
+                   Header + Body + Footer,TestStream.GetContents())
+    }//WriteV
+
+    {//WriteVThrowing
+        const String Body = "When the moon retires its gleam,";
+        StreamWriteSegment Segments[1] = { { Body.data(), 32 } };
+
+        OutputStreamThrowingBuffer ThrowingBuffer;
+        std::ostream QuietStream(&ThrowingBuffer);
+        Boole QuietThrew = false;
+        try {
+            StreamTools::WriteV(QuietStream,Segments,1);
+        }catch(...) {
+            QuietThrew = true;
+        }
+        TEST_EQUAL("WriteV(std::ostream&,const_StreamWriteSegment*,const_size_t)-Throwing-Contained",
+                   false,QuietThrew)
+        TEST_EQUAL("WriteV(std::ostream&,const_StreamWriteSegment*,const_size_t)-Throwing-Bad",
+                   true,QuietStream.bad())
+
+        std::ostream LoudStream(&ThrowingBuffer);
+        LoudStream.exceptions(std::ios_base::badbit);
+        Boole LoudRethrew = false;
+        try {
+            StreamTools::WriteV(LoudStream,Segments,1);
+        }catch( std::runtime_error& ) {
+            LoudRethrew = true;
+        }
+        TEST_EQUAL("WriteV(std::ostream&,const_StreamWriteSegment*,const_size_t)-Throwing-Rethrown",
+                   true,LoudRethrew)
+        TEST_EQUAL("WriteV(std::ostream&,const_StreamWriteSegment*,const_size_t)-Throwing-RethrownBad",
+                   true,LoudStream.bad())
+    }//WriteVThrowing
+}
+
+#endif // Mezz_IOStreams_OutputStreamTests_h
@@ -0,0 +1,136 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_ParallelLineToolsTests_h
+#define Mezz_IOStreams_ParallelLineToolsTests_h
+
+/// @file
+/// @brief This file tests the functionality of the ParallelLineTools utilities.
+
+#include "MezzTest.h"
+#include "MezzException.h"
+
+#include "ParallelLineTools.h"
+#include "PipeStream.h"
+#include "SegmentedMemoryStream.h"
+
+AUTOMATIC_TEST_GROUP(ParallelLineToolsTests,ParallelLineTools)
+{
+    using namespace Mezzanine;
+
+    // Lines of varying length, each holding its own line number.
+    String TestString;
+    for( size_t Line = 0 ; Line < 1000 ; ++Line )
+        { TestString.append(std::to_string(Line)).append(Line % 7,'.').push_back('\n'); }
+    TestString.append("1000");
+    SegmentedMemoryStream Source(4096);
+    Source.Write(TestString.data(),static_cast<StreamSize>(TestString.size()));
+
+    {//Splitting
+        const std::vector<StreamRange> Ranges = ParallelLineTools::SplitLines(Source,8);
+        TEST_EQUAL("SplitLines(InputStreamBase&,const_size_t,const_Char8)-Count",
+                   size_t(8),Ranges.size())
+        Boole Contiguous = ( Ranges.front().Start == 0 );
+        Boole LineAligned = true;
+        StreamOff Expected = 0;
+        for( const StreamRange& Range : Ranges )
+        {
+            Contiguous = Contiguous && Range.Start == Expected && Range.Size > 0;
+            LineAligned = LineAligned && ( Range.Start == 0 || TestString[static_cast<size_t>(Range.Start) - 1] == '\n' );
+            Expected = Range.Start + Range.Size;
+        }
+        TEST_EQUAL("SplitLines(InputStreamBase&,const_size_t,const_Char8)-Contiguous",
+                   true,Contiguous && Expected == static_cast<StreamOff>( TestString.size() ))
+        TEST_EQUAL("SplitLines(InputStreamBase&,const_size_t,const_Char8)-LineAligned",
+                   true,LineAligned)
+
+        SegmentedMemoryStream Tiny;
+        Tiny.Write("a\nb",3);
+        TEST_EQUAL("SplitLines(InputStreamBase&,const_size_t,const_Char8)-FewLines",
+                   size_t(2),ParallelLineTools::SplitLines(Tiny,16).size())
+        SegmentedMemoryStream Empty;
+        TEST_EQUAL("SplitLines(InputStreamBase&,const_size_t,const_Char8)-Empty",
+                   true,ParallelLineTools::SplitLines(Empty,4).empty())
+
+        TEST_THROW("SplitLines(InputStreamBase&,const_size_t,const_Char8)-Unseekable",
+                   Mezzanine::Exception::StreamReadError,
+                   [](){
+                        auto Pipe = Mezzanine::CreatePipe();
+                        (void)Mezzanine::ParallelLineTools::SplitLines(*Pipe.first,4);
+                   })
+    }//Splitting
+
+    {//Processing
+        AsyncReadQueue Queue(4);
+        using LineSpan = std::pair<size_t,size_t>;
+        const std::vector<LineSpan> Spans = ParallelLineTools::ProcessLines(Source,6,[](TextStreamReader& Reader) {
+            LineSpan Span(0,0);
+            Boole First = true;
+            for( StringView Line : Reader.ReadLines() )
+            {
+                const size_t Number = std::stoul( String( Line.substr(0,Line.find('.')) ) );
+                Span.first = ( First ? Number : Span.first );
+                Span.second = Number;
+                First = false;
+            }
+            return Span;
+        },'\n',Queue);
+        Boole InOrder = ( Spans.front().first == 0 && Spans.back().second == 1000 );
+        for( size_t Index = 1 ; Index < Spans.size() ; ++Index )
+            { InOrder = InOrder && Spans[Index].first == Spans[Index - 1].second + 1; }
+        TEST_EQUAL("ProcessLines(InputStreamBase&,const_size_t,Worker,const_Char8,AsyncReadQueue&)-Count",
+                   size_t(6),Spans.size())
+        TEST_EQUAL("ProcessLines(InputStreamBase&,const_size_t,Worker,const_Char8,AsyncReadQueue&)-InOrder",
+                   true,InOrder)
+
+        auto ThrowingProcess = [&Source,&Queue]() {
+            (void)ParallelLineTools::ProcessLines(Source,4,[](TextStreamReader& Reader) {
+                if( Reader.ReadLine() == "0" ) {
+                    MEZZ_EXCEPTION(StreamReadErrorCode,"Test failure.")
+                }
+                return 0;
+            },'\n',Queue);
+        };
+        TEST_THROW("ProcessLines(InputStreamBase&,const_size_t,Worker,const_Char8,AsyncReadQueue&)-WorkerThrows",
+                   Mezzanine::Exception::StreamReadError,
+                   ThrowingProcess)
+    }//Processing
+}
+
+#endif // Mezz_IOStreams_ParallelLineToolsTests_h
@@ -0,0 +1,182 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_PipeStreamTests_h
+#define Mezz_IOStreams_PipeStreamTests_h
+
+/// @file
+/// @brief This file tests the functionality of the PipeInputStream and PipeOutputStream classes.
+
+#include "MezzTest.h"
+
+#include "PipeStream.h"
+
+#include <thread>
+
+AUTOMATIC_TEST_GROUP(PipeStreamTests,PipeStream)
+{
+    using namespace Mezzanine;
+
+    String TestBuffer(100000,'\0');
+    for( size_t CurrByte = 0 ; CurrByte < TestBuffer.size() ; ++CurrByte )
+    {
+        TestBuffer[CurrByte] = static_cast<Char8>( ( CurrByte * 13 + CurrByte / 241 ) % 256 );
+    }
+
+    {//Ring
+        PipeRing TestRing(100,PipeWaitPolicy::Spin);
+        TEST_EQUAL("GetCapacity()_const-RoundedUp",
+                   size_t(128),TestRing.GetCapacity())
+        TEST_EQUAL("GetWaitPolicy()_const",
+                   true,TestRing.GetWaitPolicy() == PipeWaitPolicy::Spin)
+
+        Char8* WriteStart = nullptr;
+        TEST_EQUAL("GetWritable(Char8*&)-Empty",
+                   size_t(128),TestRing.GetWritable(WriteStart))
+        TestRing.CommitWrite(100);
+        TEST_EQUAL("GetBufferedSize()_const",
+                   size_t(100),TestRing.GetBufferedSize())
+        TEST_EQUAL("GetWritable(Char8*&)-Partial",
+                   size_t(28),TestRing.GetWritable(WriteStart))
+
+        Char8* ReadStart = nullptr;
+        TEST_EQUAL("GetReadable(Char8*&)",
+                   size_t(100),TestRing.GetReadable(ReadStart))
+        TestRing.CommitRead(90);
+        TEST_EQUAL("GetWritable(Char8*&)-ToEndOfRing",
+                   size_t(28),TestRing.GetWritable(WriteStart))
+        TestRing.CommitWrite(28);
+        TEST_EQUAL("GetWritable(Char8*&)-Wrapped",
+                   size_t(90),TestRing.GetWritable(WriteStart))
+        TEST_EQUAL("GetReadable(Char8*&)-ToEndOfRing",
+                   size_t(38),TestRing.GetReadable(ReadStart))
+
+        TestRing.CloseWriter();
+        TEST_EQUAL("WaitForData()-ClosedWithData",
+                   true,TestRing.WaitForData())
+        TestRing.CommitRead(38);
+        TEST_EQUAL("WaitForData()-ClosedAndEmpty",
+                   false,TestRing.WaitForData())
+        TestRing.CloseReader();
+        TEST_EQUAL("WaitForSpace()-ReaderClosed",
+                   false,TestRing.WaitForSpace())
+    }//Ring
+
+    {//SingleThread
+        auto [Reader, Writer] = CreatePipe(256,PipeWaitPolicy::Spin);
+        TEST_EQUAL("CanSeek()_const",
+                   false,Reader->CanSeek())
+
+        Writer->Write(TestBuffer.data(),40);
+        TEST_EQUAL("GetSize()_const-BeforeFlush",
+                   StreamSize(0),Reader->GetSize())
+        TEST_EQUAL("Flush()",
+                   true,Writer->Flush())
+        TEST_EQUAL("GetSize()_const-AfterFlush",
+                   StreamSize(40),Reader->GetSize())
+        Writer->Write(TestBuffer.data() + 40,60);
+        Writer->Flush();
+        TEST_EQUAL("GetSize()_const-SecondFlush",
+                   StreamSize(100),Reader->GetSize())
+        TEST_EQUAL("GetWritePosition()",
+                   StreamPos(100),Writer->GetWritePosition())
+
+        String Result(60,'\0');
+        TEST_EQUAL("Read(void*,const_StreamSize)-Count",
+                   size_t(60),Reader->Read(&Result[0],60))
+        TEST_EQUAL("Read(void*,const_StreamSize)-Value",
+                   TestBuffer.substr(0,60),Result)
+        TEST_EQUAL("GetReadPosition()",
+                   StreamPos(60),Reader->GetReadPosition())
+
+        Writer.reset();
+        Result.assign(60,'\0');
+        TEST_EQUAL("Read(void*,const_StreamSize)-WriterClosed-Count",
+                   size_t(40),Reader->Read(&Result[0],60))
+        TEST_EQUAL("Read(void*,const_StreamSize)-WriterClosed-Value",
+                   TestBuffer.substr(60,40),Result.substr(0,40))
+        TEST_EQUAL("EoF()_const-WriterClosed",
+                   true,Reader->EoF())
+    }//SingleThread
+
+    {//ReaderClosed
+        auto [Reader, Writer] = CreatePipe(256,PipeWaitPolicy::Block);
+        Reader.reset();
+        TEST_EQUAL("Write(const_void*,StreamSize)-ReaderClosed",
+                   false,Writer->Write(TestBuffer.data(),1000))
+    }//ReaderClosed
+
+    for( const PipeWaitPolicy Policy : { PipeWaitPolicy::Spin, PipeWaitPolicy::Block } )
+    {//Threaded
+        const String PolicyName = ( Policy == PipeWaitPolicy::Spin ? "Spin" : "Block" );
+        auto [Reader, Writer] = CreatePipe(1000,Policy);
+        std::thread WriterThread([&TestBuffer,Output = std::move(Writer)]() mutable {
+            size_t TotalWritten = 0;
+            for( size_t ChunkSize = 1 ; TotalWritten < TestBuffer.size() ; ChunkSize = ( ChunkSize * 7 ) % 1500 + 1 )
+            {
+                const size_t Count = std::min(ChunkSize,TestBuffer.size() - TotalWritten);
+                Output->Write(TestBuffer.data() + TotalWritten,static_cast<StreamSize>(Count));
+                TotalWritten += Count;
+            }
+            Output.reset();
+        });
+
+        String Result(TestBuffer.size() + 100,'\0');
+        size_t TotalRead = 0;
+        for( size_t ChunkSize = 1 ; TotalRead < Result.size() ; ChunkSize = ( ChunkSize * 5 ) % 2000 + 1 )
+        {
+            const size_t Count = Reader->Read(&Result[TotalRead],static_cast<StreamSize>(ChunkSize));
+            TotalRead += Count;
+            if( Reader->EoF() ) {
+                break;
+            }
+        }
+        WriterThread.join();
+        Result.resize(TotalRead);
+
+        TEST_EQUAL("Read(void*,const_StreamSize)-Threaded-" + PolicyName + "-Count",
+                   TestBuffer.size(),TotalRead)
+        TEST_EQUAL("Read(void*,const_StreamSize)-Threaded-" + PolicyName + "-Value",
+                   TestBuffer,Result)
+        TEST_EQUAL("EoF()_const-Threaded-" + PolicyName,
+                   true,Reader->EoF())
+    }//Threaded
+}
+
+#endif // Mezz_IOStreams_PipeStreamTests_h
@@ -0,0 +1,108 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_RangeStreamTests_h
+#define Mezz_IOStreams_RangeStreamTests_h
+
+/// @file
+/// @brief This file tests the functionality of the RangeInputBuffer and RangeInputStream classes.
+
+#include "MezzTest.h"
+
+#include "RangeStream.h"
+#include "SegmentedMemoryStream.h"
+
+AUTOMATIC_TEST_GROUP(RangeStreamTests,RangeStream)
+{
+    using namespace Mezzanine;
+
+    const String TestString = "Roses are red,\nViolets are blue,\nSugar is sweet,\nAnd so are you.";
+    SegmentedMemoryStream Source(16);
+    Source.Write(TestString.data(),static_cast<StreamSize>(TestString.size()));
+
+    {//Stream
+        RangeInputStream TestStream(Source,StreamRange{ 15, 18 });
+        TEST_EQUAL("GetSize()_const",
+                   StreamSize(18),TestStream.GetSize())
+        TEST_EQUAL("GetIdentifier()_const",
+                   Source.GetIdentifier(),TestStream.GetIdentifier())
+        String Line;
+        std::getline(TestStream,Line);
+        TEST_EQUAL("Read-Line",
+                   String("Violets are blue,"),Line)
+        TEST_EQUAL("Read-AtEnd",
+                   true,TestStream.get() == std::char_traits<char>::eof() && TestStream.eof())
+
+        TestStream.clear();
+        TestStream.seekg(-5,std::ios_base::end);
+        TEST_EQUAL("seekg-End",
+                   StreamPos(13),TestStream.tellg())
+        Char8 Tail[8] = {};
+        TestStream.read(Tail,sizeof(Tail));
+        TEST_EQUAL("seekg-End-Read",
+                   String("lue,\n"),String(Tail,static_cast<size_t>(TestStream.gcount())))
+        TestStream.clear();
+        TestStream.seekg(40);
+        TEST_EQUAL("seekg-OutOfRange",
+                   true,TestStream.fail())
+    }//Stream
+
+    {//Buffer
+        // A get area smaller than the range, so the range is read in several pieces.
+        RangeInputBuffer SmallBuffer(Source,StreamRange{ 33, 31 },5);
+        std::istream SmallStream(&SmallBuffer);
+        String Contents;
+        Char8 Next = '\0';
+        while( SmallStream.get(Next) )
+            { Contents.push_back(Next); }
+        TEST_EQUAL("underflow()",
+                   String("Sugar is sweet,\nAnd so are you."),Contents)
+
+        SmallStream.clear();
+        SmallStream.seekg(6);
+        String Word;
+        SmallStream >> Word;
+        TEST_EQUAL("seekpos(pos_type,std::ios_base::openmode)",
+                   String("is"),Word)
+        TEST_EQUAL("showmanyc()",
+                   std::streamsize(23),SmallBuffer.showmanyc())
+    }//Buffer
+}
+
+#endif // Mezz_IOStreams_RangeStreamTests_h
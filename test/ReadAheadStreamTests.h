@@ -0,0 +1,210 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_ReadAheadStreamTests_h
+#define Mezz_IOStreams_ReadAheadStreamTests_h
+
+/// @file
+/// @brief This file tests the functionality of the ReadAheadInputStream class.
+
+#include "MezzTest.h"
+
+#include "ReadAheadStream.h"
+
+#include <cstdio>
+#include <future>
+#include <vector>
+
+AUTOMATIC_TEST_GROUP(ReadAheadStreamTests,ReadAheadStream)
+{
+    using namespace Mezzanine;
+
+    // Set everything up for our test.
+    const String TestFileName = "ReadAheadStreamTests.bin";
+    String TestBuffer(10000,'\0');
+    for( size_t CurrByte = 0 ; CurrByte < TestBuffer.size() ; ++CurrByte )
+    {
+        TestBuffer[CurrByte] = static_cast<Char8>( ( CurrByte * 7 + CurrByte / 251 ) % 256 );
+    }
+    {
+        std::ofstream TestFile(TestFileName,std::ios::out | std::ios::binary | std::ios::trunc);
+        TestFile.write(TestBuffer.data(),static_cast<StreamSize>(TestBuffer.size()));
+    }
+
+    {//Opening
+        ReadAheadInputStream MissingStream("ZZZ_NoSuchFile.txt.bad");
+        TEST_EQUAL("IsOpen()_const-MissingFile",
+                   false,MissingStream.IsOpen())
+        TEST_EQUAL("Fail()_const-MissingFile",
+                   true,MissingStream.Fail())
+
+        ReadAheadInputStream TestStream(TestFileName,256,3);
+        TEST_EQUAL("IsOpen()_const-TestFile",
+                   true,TestStream.IsOpen())
+        TEST_EQUAL("GetIdentifier()_const",
+                   TestFileName,TestStream.GetIdentifier())
+        TEST_EQUAL("GetSize()_const",
+                   StreamSize(10000),TestStream.GetSize())
+        TEST_EQUAL("IsPrefetching()-Initial",
+                   true,TestStream.IsPrefetching())
+    }//Opening
+
+    {//SequentialReading
+        ReadAheadInputStream TestStream(TestFileName,256,3);
+        String Result(TestBuffer.size(),'\0');
+        size_t TotalRead = 0;
+        while( TotalRead < Result.size() )
+        {
+            const StreamSize ChunkSize = std::min(StreamSize(300),static_cast<StreamSize>(Result.size() - TotalRead));
+            TotalRead += TestStream.Read(&Result[TotalRead],ChunkSize);
+        }
+        TEST_EQUAL("Read(void*,const_StreamSize)-Sequential-Value",
+                   TestBuffer,Result)
+        TEST_EQUAL("GetReadPosition()-Sequential",
+                   StreamPos(10000),TestStream.GetReadPosition())
+
+        Char8 PastEnd = 0;
+        TEST_EQUAL("Read(void*,const_StreamSize)-PastEnd",
+                   size_t(0),TestStream.Read(&PastEnd,1))
+        TEST_EQUAL("EoF()_const",
+                   true,TestStream.EoF())
+    }//SequentialReading
+
+    {//Seeking
+        ReadAheadInputStream TestStream(TestFileName,256,3);
+        Char8 ReadBuffer[64] = {};
+
+        TestStream.SetReadPosition(StreamPos(100));
+        TestStream.Read(ReadBuffer,64);
+        TEST_EQUAL("SetReadPosition(StreamPos)-InBuffer",
+                   TestBuffer.substr(100,64),String(ReadBuffer,64))
+        TEST_EQUAL("IsPrefetching()-InBuffer",
+                   true,TestStream.IsPrefetching())
+
+        TestStream.SetReadPosition(StreamPos(9000));
+        TestStream.Read(ReadBuffer,64);
+        TEST_EQUAL("SetReadPosition(StreamPos)-Random-First",
+                   TestBuffer.substr(9000,64),String(ReadBuffer,64))
+        TestStream.SetReadPosition(-5000,SeekOrigin::End);
+        TEST_EQUAL("SetReadPosition(StreamOff,SeekOrigin)-End",
+                   StreamPos(5000),TestStream.GetReadPosition())
+        TestStream.Read(ReadBuffer,64);
+        TEST_EQUAL("SetReadPosition(StreamOff,SeekOrigin)-Random-Second",
+                   TestBuffer.substr(5000,64),String(ReadBuffer,64))
+        TEST_EQUAL("IsPrefetching()-Random",
+                   false,TestStream.IsPrefetching())
+
+        String Result(2000,'\0');
+        TEST_EQUAL("Read(void*,const_StreamSize)-AfterRandom-Count",
+                   size_t(2000),TestStream.Read(&Result[0],2000))
+        TEST_EQUAL("Read(void*,const_StreamSize)-AfterRandom-Value",
+                   TestBuffer.substr(5064,2000),Result)
+        TEST_EQUAL("IsPrefetching()-Sequential",
+                   true,TestStream.IsPrefetching())
+
+        TestStream.SetReadPosition(StreamPos(20000));
+        TEST_EQUAL("Read(void*,const_StreamSize)-PastEnd",
+                   size_t(0),TestStream.Read(ReadBuffer,64))
+        TEST_EQUAL("EoF()_const-PastEnd",
+                   true,TestStream.EoF())
+    }//Seeking
+
+    {//ReadAt
+        ReadAheadInputStream TestStream(TestFileName,256,3);
+        Char8 ReadBuffer[64] = {};
+        TestStream.Read(ReadBuffer,10);
+
+        // Positional reads from both the buffered data and elsewhere in the file.
+        Char8 PositionalBuffer[300] = {};
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-Buffered-Count",
+                   StreamSize(300),TestStream.ReadAt(StreamPos(100),PositionalBuffer,300))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-Buffered-Value",
+                   TestBuffer.substr(100,300),String(PositionalBuffer,300))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-Unbuffered-Count",
+                   StreamSize(300),TestStream.ReadAt(StreamPos(8000),PositionalBuffer,300))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-Unbuffered-Value",
+                   TestBuffer.substr(8000,300),String(PositionalBuffer,300))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-PastEnd-Count",
+                   StreamSize(100),TestStream.ReadAt(StreamPos(9900),PositionalBuffer,300))
+        std::future<StreamSize> AsyncRead = TestStream.ReadAsync(StreamPos(6000),PositionalBuffer,300);
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-Count",
+                   StreamSize(300),AsyncRead.get())
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-Value",
+                   TestBuffer.substr(6000,300),String(PositionalBuffer,300))
+
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-StillPrefetching",
+                   true,TestStream.IsPrefetching())
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-ReadPosition",
+                   StreamPos(10),TestStream.GetReadPosition())
+        String Result(TestBuffer.size() - 10,'\0');
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-SequentialAfter-Count",
+                   Result.size(),TestStream.Read(&Result[0],static_cast<StreamSize>(Result.size())))
+        TEST_EQUAL("ReadAt(const_StreamPos,void*,const_StreamSize)-SequentialAfter-Value",
+                   TestBuffer.substr(10),Result)
+
+        // Positional reads don't use the read position, so sequential reading can carry on alongside them.
+        ReadAheadInputStream SharedStream(TestFileName,256,3);
+        std::vector<String> AsyncResults(32,String(100,'\0'));
+        std::vector< std::future<StreamSize> > Pending;
+        for( size_t CurrRead = 0 ; CurrRead < AsyncResults.size() ; ++CurrRead )
+        {
+            const StreamPos Position( static_cast<StreamOff>( CurrRead * 311 ) );
+            Pending.push_back( SharedStream.ReadAsync(Position,&AsyncResults[CurrRead][0],100) );
+        }
+        String SyncResult;
+        Char8 Chunk[37] = {};
+        size_t ChunkRead = 0;
+        while( ( ChunkRead = SharedStream.Read(Chunk,37) ) > 0 )
+            { SyncResult.append(Chunk,ChunkRead); }
+        Boole AsyncMatched = true;
+        for( size_t CurrRead = 0 ; CurrRead < AsyncResults.size() ; ++CurrRead )
+        {
+            AsyncMatched = AsyncMatched && Pending[CurrRead].get() == 100 &&
+                           AsyncResults[CurrRead] == TestBuffer.substr(CurrRead * 311,100);
+        }
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-WhileReading-AsyncValues",
+                   true,AsyncMatched)
+        TEST_EQUAL("ReadAsync(const_StreamPos,void*,const_StreamSize)-WhileReading-SyncValue",
+                   TestBuffer,SyncResult)
+    }//ReadAt
+
+    std::remove(TestFileName.c_str());
+}
+
+#endif // Mezz_IOStreams_ReadAheadStreamTests_h
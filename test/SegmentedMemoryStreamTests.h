@@ -0,0 +1,142 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_SegmentedMemoryStreamTests_h
+#define Mezz_IOStreams_SegmentedMemoryStreamTests_h
+
+/// @file
+/// @brief This file tests the functionality of the SegmentedMemoryStream class.
+
+#include "MezzTest.h"
+
+#include "SegmentedMemoryStream.h"
+
+AUTOMATIC_TEST_GROUP(SegmentedMemoryStreamTests,SegmentedMemoryStream)
+{
+    using namespace Mezzanine;
+
+    const String TestString = "Roses are red,\nViolets are blue,\nSugar is sweet,\nAnd so are you.";
+
+    {//Writing
+        BufferPool::Trim();
+        SegmentedMemoryStream TestStream(16);
+        TEST_EQUAL("GetSize()_const-Empty",
+                   StreamSize(0),TestStream.GetSize())
+
+        TEST_EQUAL("Write(const_void*,StreamSize)",
+                   true,TestStream.Write(TestString.data(),static_cast<StreamSize>(TestString.size())))
+        TEST_EQUAL("GetSize()_const",
+                   static_cast<StreamSize>(TestString.size()),TestStream.GetSize())
+        TEST_EQUAL("GetWritePosition()",
+                   StreamPos( static_cast<StreamOff>(TestString.size()) ),TestStream.GetWritePosition())
+
+        std::vector<StreamWriteSegment> Segments = TestStream.GetSegments();
+        TEST_EQUAL("GetSegments()-Count",
+                   size_t(4),Segments.size())
+        TEST_EQUAL("GetSegments()-LastSize",
+                   StreamSize(16),Segments.back().Size)
+        String Joined;
+        for( const StreamWriteSegment& Segment : Segments )
+            { Joined.append(static_cast<const Char8*>(Segment.Buffer),static_cast<size_t>(Segment.Size)); }
+        TEST_EQUAL("GetSegments()-Value",
+                   TestString,Joined)
+
+        TestStream.Write("!",1);
+        Segments = TestStream.GetSegments();
+        TEST_EQUAL("Write(const_void*,StreamSize)-NewSegment-Count",
+                   size_t(5),Segments.size())
+        TEST_EQUAL("Write(const_void*,StreamSize)-NewSegment-Size",
+                   StreamSize(1),Segments.back().Size)
+
+        TestStream.SetWritePosition(StreamPos(0));
+        TestStream.Write("Posie",5);
+        TestStream.SetWritePosition(0,SeekOrigin::End);
+        TEST_EQUAL("SetWritePosition(StreamOff,SeekOrigin)-End",
+                   StreamPos(65),TestStream.GetWritePosition())
+        TEST_EQUAL("GetSize()_const-AfterOverwrite",
+                   StreamSize(65),TestStream.GetSize())
+
+        TestStream.Clear();
+        TEST_EQUAL("Clear()-Size",
+                   StreamSize(0),TestStream.GetSize())
+        TEST_EQUAL("Clear()-SegmentsReturned",
+                   size_t(5),BufferPool::GetThreadCachedCount(16))
+    }//Writing
+
+    {//Reading
+        SegmentedMemoryStream TestStream(16);
+        TestStream.Write(TestString.data(),static_cast<StreamSize>(TestString.size()));
+
+        String Result(TestString.size(),'\0');
+        TEST_EQUAL("Read(void*,const_StreamSize)-Count",
+                   TestString.size(),TestStream.Read(&Result[0],static_cast<StreamSize>(Result.size())))
+        TEST_EQUAL("Read(void*,const_StreamSize)-Value",
+                   TestString,Result)
+
+        TestStream.Write("Yes.",4);
+        Char8 Appended[4] = {};
+        TEST_EQUAL("Read(void*,const_StreamSize)-AfterAppend-Count",
+                   size_t(4),TestStream.Read(Appended,4))
+        TEST_EQUAL("Read(void*,const_StreamSize)-AfterAppend-Value",
+                   String("Yes."),String(Appended,4))
+
+        TestStream.SetReadPosition(StreamPos(33));
+        Char8 Line[26] = {};
+        TestStream.ReadLine(Line,26);
+        TEST_EQUAL("SetReadPosition(StreamPos)-AcrossSegments",
+                   String("Sugar is sweet,"),String(Line))
+
+        TestStream.SetReadPosition(StreamPos(1000));
+        TEST_EQUAL("SetReadPosition(StreamPos)-PastEnd",
+                   true,TestStream.Fail())
+        TestStream.ClearErrors();
+
+        SegmentedMemoryStream CopyStream(16);
+        TEST_EQUAL("WriteTo(OutputStreamBase&)",
+                   true,TestStream.WriteTo(CopyStream))
+        TEST_EQUAL("WriteTo(OutputStreamBase&)-Size",
+                   TestStream.GetSize(),CopyStream.GetSize())
+        Result.assign(TestString.size() + 4,'\0');
+        CopyStream.Read(&Result[0],static_cast<StreamSize>(Result.size()));
+        TEST_EQUAL("WriteTo(OutputStreamBase&)-Value",
+                   TestString + "Yes.",Result)
+    }//Reading
+}
+
+#endif // Mezz_IOStreams_SegmentedMemoryStreamTests_h
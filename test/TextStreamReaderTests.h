@@ -46,8 +46,67 @@
 #include "MezzTest.h"
 #include "MezzException.h"
 
+#include "SegmentedMemoryStream.h"
+#include "StreamTools.h"
 #include "TextStreamReader.h"
 
+#include <limits>
+#include <sstream>
+#include <vector>
+
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+/// @brief A streambuf that hands out its data a few bytes at a time, or a byte at a time without a buffer.
+class TextStreamReaderChunkedBuffer : public std::streambuf
+{
+protected:
+    /// @brief The data to hand out.
+    Mezzanine::String Data;
+    /// @brief The number of bytes handed out so far.
+    size_t Position = 0;
+    /// @brief The number of bytes to hand out per refill, or 0 to not use a buffer.
+    size_t ChunkSize;
+
+    /// @brief Hands out the next chunk of data.
+    /// @return Returns the next character, or eof when all data has been handed out.
+    int_type underflow() override
+    {
+        if( this->Position >= this->Data.size() ) {
+            return traits_type::eof();
+        }
+        if( this->ChunkSize == 0 ) {
+            return traits_type::to_int_type(this->Data[this->Position]);
+        }
+        const size_t Size = std::min(this->ChunkSize,this->Data.size() - this->Position);
+        char* Chunk = &this->Data[this->Position];
+        this->setg(Chunk,Chunk,Chunk + Size);
+        this->Position += Size;
+        return traits_type::to_int_type(*Chunk);
+    }
+    /// @brief Hands out the next character when not using a buffer.
+    /// @return Returns the next character, or eof when all data has been handed out.
+    int_type uflow() override
+    {
+        if( this->ChunkSize != 0 ) {
+            return std::streambuf::uflow();
+        }
+        if( this->Position >= this->Data.size() ) {
+            return traits_type::eof();
+        }
+        return traits_type::to_int_type(this->Data[this->Position++]);
+    }
+public:
+    /// @brief Class constructor.
+    /// @param ToHandOut The data to hand out.
+    /// @param Chunk The number of bytes to hand out per refill, or 0 to not use a buffer.
+    TextStreamReaderChunkedBuffer(const Mezzanine::String& ToHandOut, const size_t Chunk) :
+        Data(ToHandOut),
+        ChunkSize(Chunk)
+        {  }
+};//TextStreamReaderChunkedBuffer
+RESTORE_WARNING_STATE
+
 AUTOMATIC_TEST_GROUP(TextStreamReaderTests,TextStreamReader)
 {
     using namespace Mezzanine;
@@ -106,6 +165,205 @@ AUTOMATIC_TEST_GROUP(TextStreamReaderTests,TextStreamReader)
 
     TEST_EQUAL("AtEnd()_const-End",
                true,TestReader.AtEnd())
+
+    {//LineViews
+        StdInputStreamPtr ViewStream = std::make_shared<std::istringstream>(TestBuffer);
+        TextStreamReader ViewReader(ViewStream);
+        StringView Line;
+        TEST_EQUAL("ReadLineView(StringView&,const_Char8)-Valid",
+                   true,ViewReader.ReadLineView(Line))
+        TEST_EQUAL("ReadLineView(StringView&,const_Char8)-Value",
+                   StringView("When the moon retires its gleam,"),Line)
+        TEST_EQUAL("ReadLineView(StringView&,const_Char8)-FDelim",
+                   true,ViewReader.ReadLineView(Line,'f') && Line == "And sunlight shines upon the dew,\nDo you rise ")
+
+        std::vector<String> Lines;
+        for( StringView Remaining : ViewReader.ReadLines() )
+            { Lines.emplace_back(Remaining); }
+        TEST_EQUAL("ReadLines(const_Char8)-Count",
+                   size_t(2),Lines.size())
+        TEST_EQUAL("ReadLines(const_Char8)-Last",
+                   String("Or slumber on in a waking dream..."),Lines.back())
+        TEST_EQUAL("ReadLineView(StringView&,const_Char8)-PastEnd",
+                   false,ViewReader.ReadLineView(Line))
+        TEST_EQUAL("ReadLineView(StringView&,const_Char8)-PastEnd-Fail",
+                   true,ViewStream->fail())
+    }//LineViews
+
+    {//LineBoundaries
+        const String Text = "first line\n\nthird line is longer than a chunk\nlast";
+        auto ReadChunked = [&Text](const size_t ChunkSize) {
+            TextStreamReaderChunkedBuffer ChunkedBuffer(Text,ChunkSize);
+            StdInputStreamPtr ChunkedStream = std::make_shared<std::istream>(&ChunkedBuffer);
+            TextStreamReader ChunkedReader(ChunkedStream);
+            std::vector<String> Lines;
+            for( StringView Remaining : ChunkedReader.ReadLines() )
+                { Lines.emplace_back(Remaining); }
+            return ( Lines.size() == 4 && Lines[0] == "first line" && Lines[1].empty() &&
+                     Lines[2] == "third line is longer than a chunk" && Lines[3] == "last" );
+        };
+        TEST_EQUAL("ReadLines(const_Char8)-Unbuffered",
+                   true,ReadChunked(0))
+        TEST_EQUAL("ReadLines(const_Char8)-SingleByteChunks",
+                   true,ReadChunked(1))
+        TEST_EQUAL("ReadLines(const_Char8)-SmallChunks",
+                   true,ReadChunked(4))
+        TEST_EQUAL("ReadLines(const_Char8)-LargeChunks",
+                   true,ReadChunked(64))
+    }//LineBoundaries
+
+    {//Scanning
+        // Place the target at every offset of a buffer long enough to use each SIMD width and the scalar tail.
+        String Haystack(100,'a');
+        Boole AllFound = true;
+        for( size_t Offset = 0 ; Offset < Haystack.size() ; ++Offset )
+        {
+            Haystack[Offset] = '\n';
+            const Char8* Begin = Haystack.data();
+            const Char8* Found = StreamTools::FindCharacter(Begin,Begin + Haystack.size(),'\n');
+            AllFound = AllFound && Found == Begin + Offset;
+            Haystack[Offset] = 'a';
+        }
+        TEST_EQUAL("FindCharacter(const_Char8*,const_Char8*,const_Char8)-EveryOffset",
+                   true,AllFound)
+        TEST_EQUAL("FindCharacter(const_Char8*,const_Char8*,const_Char8)-Missing",
+                   Haystack.data() + Haystack.size(),
+                   StreamTools::FindCharacter(Haystack.data(),Haystack.data() + Haystack.size(),'\n'))
+
+        StdInputStreamPtr SkipStream = std::make_shared<std::istringstream>(TestBuffer);
+        TextStreamReader SkipReader(SkipStream);
+        TEST_EQUAL("SkipUntil(const_Char8)-First",
+                   StreamSize(33),SkipReader.SkipUntil())
+        TEST_EQUAL("SkipUntil(const_Char8)-QuestionMark",
+                   StreamSize(60),SkipReader.SkipUntil('?'))
+        TEST_EQUAL("SkipUntil(const_Char8)-Missing",
+                   StreamSize(35),SkipReader.SkipUntil('#'))
+        TEST_EQUAL("SkipUntil(const_Char8)-Missing-Eof",
+                   true,SkipStream->eof() && !SkipStream->fail())
+
+        TextStreamReaderChunkedBuffer ChunkedBuffer(TestBuffer,5);
+        StdInputStreamPtr ChunkedStream = std::make_shared<std::istream>(&ChunkedBuffer);
+        TextStreamReader ChunkedReader(ChunkedStream);
+        ChunkedReader.SkipUntil('\n');
+        ChunkedReader.SkipUntil('\n');
+        TEST_EQUAL("SkipUntil(const_Char8)-Chunked",
+                   String("Do you rise from bed anew?"),ChunkedReader.ReadLine())
+        TEST_EQUAL("ReadLine(const_Char8)-Chunked-Last",
+                   String("Or slumber on in a waking dream..."),ChunkedReader.ReadLine())
+        TEST_EQUAL("ReadLine(const_Char8)-Chunked-PastEnd",
+                   true,ChunkedReader.ReadLine().empty() && ChunkedStream->fail())
+    }//Scanning
+
+    {//WholeStream
+        std::shared_ptr<SegmentedMemoryStream> SizedStream = std::make_shared<SegmentedMemoryStream>(64);
+        String Large;
+        for( size_t Count = 0 ; Count < 100 ; ++Count )
+            { Large.append(TestBuffer); }
+        SizedStream->write(Large.data(),static_cast<StreamSize>( Large.size() ));
+        SizedStream->seekg(40);
+        TextStreamReader SizedReader(SizedStream);
+        TEST_EQUAL("GetAsString()-KnownSize",
+                   Large,SizedReader.GetAsString())
+        TEST_EQUAL("GetAsString()-KnownSize-PositionRestored",
+                   StreamPos(40),SizedStream->tellg())
+
+        TextStreamReaderChunkedBuffer UnseekableBuffer(Large,1000);
+        StdInputStreamPtr UnseekableStream = std::make_shared<std::istream>(&UnseekableBuffer);
+        TextStreamReader UnseekableReader(UnseekableStream);
+        UnseekableReader.SkipUntil('\n');
+        TEST_EQUAL("GetAsString()-Unseekable",
+                   Large.substr(33),UnseekableReader.GetAsString())
+        TEST_EQUAL("GetAsString()-Unseekable-AtEnd",
+                   true,UnseekableReader.AtEnd())
+
+        StdInputStreamPtr EmptyStream = std::make_shared<std::istringstream>(String());
+        TextStreamReader EmptyReader(EmptyStream);
+        TEST_EQUAL("GetAsString()-Empty",
+                   String(),EmptyReader.GetAsString())
+        TEST_EQUAL("GetAsString()-Empty-Valid",
+                   false,EmptyStream->fail())
+
+        StdInputStreamPtr EndedStream = std::make_shared<std::istringstream>(String("line1\nline2"));
+        TextStreamReader EndedReader(EndedStream);
+        const String FirstLine = EndedReader.ReadLine();
+        const String SecondLine = EndedReader.ReadLine();
+        TEST_EQUAL("GetAsString()-AfterEnd-Lines",
+                   String("line1line2"),FirstLine + SecondLine)
+        TEST_EQUAL("GetAsString()-AfterEnd",
+                   String("line1\nline2"),EndedReader.GetAsString())
+        TEST_EQUAL("GetAsString()-AfterEnd-Valid",
+                   false,EndedStream->fail())
+        TEST_EQUAL("GetAsString()-AfterEnd-EoF",
+                   true,EndedStream->eof())
+    }//WholeStream
+
+    {//Numbers
+        StdInputStreamPtr NumberStream = std::make_shared<std::istringstream>(String("  42 -17\n+8 ff 1.5e3 -0.25 inf 12abc 7"));
+        TextStreamReader NumberReader(NumberStream);
+        TEST_EQUAL("ReadInteger(const_int)-Positive",
+                   42,NumberReader.ReadInteger<int>())
+        TEST_EQUAL("ReadInteger(const_int)-Negative",
+                   Int64(-17),NumberReader.ReadInteger<Int64>())
+        TEST_EQUAL("ReadInteger(const_int)-PlusSign",
+                   UInt8(8),NumberReader.ReadInteger<UInt8>())
+        TEST_EQUAL("ReadInteger(const_int)-Hex",
+                   UInt32(255),NumberReader.ReadInteger<UInt32>(16))
+        TEST_EQUAL("ReadFloat()-Scientific",
+                   1500.0,NumberReader.ReadFloat<double>())
+        TEST_EQUAL("ReadFloat()-Negative",
+                   -0.25f,NumberReader.ReadFloat<float>())
+        TEST_EQUAL("ReadFloat()-Infinity",
+                   std::numeric_limits<double>::infinity(),NumberReader.ReadFloat<double>())
+        TEST_EQUAL("ReadInteger(const_int)-TrailingLetters",
+                   0,NumberReader.ReadInteger<int>())
+        TEST_EQUAL("ReadInteger(const_int)-TrailingLetters-Fail",
+                   true,NumberStream->fail())
+        NumberStream->clear();
+        TEST_EQUAL("ReadInteger(const_int)-AfterError",
+                   7,NumberReader.ReadInteger<int>())
+        TEST_EQUAL("ReadInteger(const_int)-PastEnd",
+                   0,NumberReader.ReadInteger<int>())
+        TEST_EQUAL("ReadInteger(const_int)-PastEnd-Fail",
+                   true,NumberStream->fail() && NumberStream->eof())
+
+        StdInputStreamPtr RangeStream = std::make_shared<std::istringstream>(String("300"));
+        TextStreamReader RangeReader(RangeStream);
+        TEST_EQUAL("ReadInteger(const_int)-OutOfRange",
+                   true,RangeReader.ReadInteger<UInt8>() == 0 && RangeStream->fail())
+
+        String Vertices;
+        for( size_t Count = 0 ; Count < 200 ; ++Count )
+            { Vertices.append("v 0.5 -1.25 3\n"); }
+        auto ReadVertices = [&Vertices](const size_t ChunkSize) {
+            TextStreamReaderChunkedBuffer ChunkedBuffer(Vertices,ChunkSize);
+            StdInputStreamPtr ChunkedStream = std::make_shared<std::istream>(&ChunkedBuffer);
+            TextStreamReader ChunkedReader(ChunkedStream);
+            Boole AllMatched = true;
+            for( size_t Count = 0 ; Count < 200 ; ++Count )
+            {
+                float Position[3] = {};
+                AllMatched = AllMatched && ChunkedReader.ReadCharacter() == 'v';
+                AllMatched = AllMatched && ChunkedReader.ReadNumbers(Position,3) == 3;
+                AllMatched = AllMatched && Position[0] == 0.5f && Position[1] == -1.25f && Position[2] == 3.0f;
+                ChunkedReader.SkipUntil('\n');
+            }
+            return AllMatched;
+        };
+        TEST_EQUAL("ReadNumbers(Number*,const_size_t)-Unbuffered",
+                   true,ReadVertices(0))
+        TEST_EQUAL("ReadNumbers(Number*,const_size_t)-SmallChunks",
+                   true,ReadVertices(3))
+        TEST_EQUAL("ReadNumbers(Number*,const_size_t)-OddChunks",
+                   true,ReadVertices(7))
+        TEST_EQUAL("ReadNumbers(Number*,const_size_t)-Buffered",
+                   true,ReadVertices(4096))
+        TEST_EQUAL("ReadNumbers(Number*,const_size_t)-Short",
+                   size_t(2),[]() {
+                        Mezzanine::TextStreamReader ShortReader( std::make_shared<std::istringstream>(Mezzanine::String("1 2")) );
+                        int Values[3] = {};
+                        return ShortReader.ReadNumbers(Values,3);
+                   }())
+    }//Numbers
 }
 
 #endif // Mezz_IOStreams_TextStreamReaderTests_h
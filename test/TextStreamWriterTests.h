@@ -47,6 +47,9 @@
 
 #include "TextStreamWriter.h"
 
+#include <sstream>
+#include <string>
+
 AUTOMATIC_TEST_GROUP(TextStreamWriterTests,TextStreamWriter)
 {
     using namespace Mezzanine;
@@ -100,6 +103,64 @@ AUTOMATIC_TEST_GROUP(TextStreamWriterTests,TextStreamWriter)
     TEST_EQUAL("Write(const_StringView)-FourthLine-SecondHalf-Value",
                SourceBuffer,TestStream->str())
 
+    {//Numbers
+        std::shared_ptr<std::ostringstream> NumberStream = std::make_shared<std::ostringstream>();
+        TextStreamWriter NumberWriter(NumberStream);
+        TEST_EQUAL("Write(const_Number)-Int-Valid",
+                   true,NumberWriter.Write(-1234))
+        NumberWriter.Write(' ');
+        NumberWriter.Write(UInt64(18446744073709551615ull));
+        NumberWriter.Write(' ');
+        NumberWriter.Write(UInt8(7));
+        TEST_EQUAL("Write(const_Number)-Integers-Value",
+                   String("-1234 18446744073709551615 7"),NumberStream->str())
+
+        NumberStream->str("");
+        NumberWriter.Write(0.1);
+        NumberWriter.Write(',');
+        NumberWriter.Write(-2.5f);
+        NumberWriter.Write(',');
+        NumberWriter.Write(1e300);
+        TEST_EQUAL("Write(const_Number)-Floats-Value",
+                   String("0.1,-2.5,1e+300"),NumberStream->str())
+
+        const double Third = 1.0 / 3.0;
+        NumberStream->str("");
+        NumberWriter.Write(Third);
+        TEST_EQUAL("Write(const_Number)-Floats-RoundTrip",
+                   Third,std::stod(NumberStream->str()))
+    }//Numbers
+
+    {//Buffered
+        std::shared_ptr<std::ostringstream> BufferedStream = std::make_shared<std::ostringstream>();
+        String Expected;
+        {
+            TextStreamWriter BufferedWriter(BufferedStream,32);
+            BufferedWriter.Write("Line ");
+            BufferedWriter.Write(1);
+            BufferedWriter.Write('\n');
+            TEST_EQUAL("Write(const_StringView)-Buffered-Held",
+                       String(),BufferedStream->str())
+            TEST_EQUAL("Flush()-Buffered-Valid",
+                       true,BufferedWriter.Flush())
+            TEST_EQUAL("Flush()-Buffered-Value",
+                       String("Line 1\n"),BufferedStream->str())
+
+            Expected = "Line 1\n";
+            for( int Line = 2 ; Line < 100 ; ++Line )
+            {
+                BufferedWriter.Write("Line ");
+                BufferedWriter.Write(Line);
+                BufferedWriter.Write('\n');
+                Expected.append("Line " + std::to_string(Line) + "\n");
+            }
+            BufferedWriter.Write(SourceBuffer);
+            Expected.append(SourceBuffer);
+        }
+        TEST_EQUAL("~TextStreamWriter()-Buffered-Value",
+                   Expected,BufferedStream->str())
+    }//Buffered
+
     // I don't know how to make a very large String without causing OOM issues.
     // Solution: Simple! Use PAE and Buy many PB of RAM!
     //TEST_THROW("Write(const_BinaryBuffer&)-Throw",
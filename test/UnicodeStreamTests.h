@@ -0,0 +1,177 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_UnicodeStreamTests_h
+#define Mezz_IOStreams_UnicodeStreamTests_h
+
+/// @file
+/// @brief This file tests the functionality of the Unicode validating and transcoding streambufs.
+
+#include "MezzTest.h"
+
+#include "UnicodeStream.h"
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wweak-vtables")
+SUPPRESS_CLANG_WARNING("-Wpadded")
+/// @brief A stringbuf that hands out at most two bytes per read, the way a pipe or socket might.
+class UnicodeShortReadBuffer : public std::stringbuf
+{
+public:
+    /// @brief Class constructor.
+    /// @param Text The contents of the buffer.
+    explicit UnicodeShortReadBuffer(const Mezzanine::String& Text) :
+        std::stringbuf(Text,std::ios_base::in)
+        {  }
+
+    std::streamsize xsgetn(char_type* Dest, std::streamsize Count) override
+        { return std::stringbuf::xsgetn(Dest,std::min(Count,std::streamsize(2))); }
+};//UnicodeShortReadBuffer
+RESTORE_WARNING_STATE
+
+AUTOMATIC_TEST_GROUP(UnicodeStreamTests,UnicodeStream)
+{
+    using namespace Mezzanine;
+
+    // Buffers of 17 bytes cut characters of every length at different points as the text repeats.
+    const String Sentence = "Plain text, W\xC3\xB6rld \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x98\x80 end.\n";
+    const std::u16string Utf16Sentence = u"Plain text, Wörld 日本 \U0001F600 end.\n";
+    String Utf8Text;
+    String Utf16Text;
+    for( size_t Count = 0 ; Count < 50 ; ++Count )
+    {
+        Utf8Text.append(Sentence);
+        for( const char16_t Unit : Utf16Sentence )
+        {
+            Utf16Text.push_back( static_cast<char>( Unit >> 8 ) );
+            Utf16Text.push_back( static_cast<char>( Unit & 0xFF ) );
+        }
+    }
+
+    auto ReadAll = [](std::streambuf& Buf) -> String {
+        std::istream Input(&Buf);
+        return String(std::istreambuf_iterator<char>(Input),std::istreambuf_iterator<char>());
+    };
+
+    {//Validating
+        std::stringbuf ValidSource(Utf8Text);
+        Utf8ValidatingBuffer ValidBuffer(&ValidSource,17);
+        TEST_EQUAL("Utf8ValidatingBuffer-Valid-Text",
+                   Utf8Text,ReadAll(ValidBuffer))
+        TEST_EQUAL("Utf8ValidatingBuffer-Valid-IsValid",
+                   true,ValidBuffer.IsValid())
+        TEST_EQUAL("Utf8ValidatingBuffer-Valid-Count",
+                   static_cast<StreamSize>( Utf8Text.size() ),ValidBuffer.GetValidatedCount())
+
+        const String Prefix = Utf8Text.substr(0,Sentence.size() * 3);
+        std::stringbuf InvalidSource(Prefix + "\xC0\xAF" + Utf8Text);
+        Utf8ValidatingBuffer InvalidBuffer(&InvalidSource,17);
+        TEST_EQUAL("Utf8ValidatingBuffer-Invalid-Text",
+                   Prefix,ReadAll(InvalidBuffer))
+        TEST_EQUAL("Utf8ValidatingBuffer-Invalid-IsValid",
+                   false,InvalidBuffer.IsValid())
+        TEST_EQUAL("Utf8ValidatingBuffer-Invalid-Count",
+                   static_cast<StreamSize>( Prefix.size() ),InvalidBuffer.GetValidatedCount())
+
+        std::stringbuf CutOffSource("ab\xE6\x97");
+        Utf8ValidatingBuffer CutOffBuffer(&CutOffSource);
+        TEST_EQUAL("Utf8ValidatingBuffer-CutOff-Text",
+                   String("ab"),ReadAll(CutOffBuffer))
+        TEST_EQUAL("Utf8ValidatingBuffer-CutOff-IsValid",
+                   false,CutOffBuffer.IsValid())
+
+        UnicodeShortReadBuffer ShortSource("\xE2\x82\xAC" "abc");
+        Utf8ValidatingBuffer ShortBuffer(&ShortSource);
+        TEST_EQUAL("Utf8ValidatingBuffer-ShortReads-Text",
+                   String("\xE2\x82\xAC" "abc"),ReadAll(ShortBuffer))
+        TEST_EQUAL("Utf8ValidatingBuffer-ShortReads-IsValid",
+                   true,ShortBuffer.IsValid())
+    }//Validating
+
+    {//Utf16Input
+        std::stringbuf MarkedSource("\xFE\xFF" + Utf16Text);
+        Utf16InputBuffer MarkedBuffer(&MarkedSource,ByteOrder::Little,17);
+        TEST_EQUAL("Utf16InputBuffer-Marked-Text",
+                   Utf8Text,ReadAll(MarkedBuffer))
+        TEST_EQUAL("Utf16InputBuffer-Marked-Order",
+                   ByteOrder::Big,MarkedBuffer.GetByteOrder())
+        TEST_EQUAL("Utf16InputBuffer-Marked-IsValid",
+                   true,MarkedBuffer.IsValid())
+
+        std::stringbuf UnmarkedSource(Utf16Text);
+        Utf16InputBuffer UnmarkedBuffer(&UnmarkedSource,ByteOrder::Big);
+        TEST_EQUAL("Utf16InputBuffer-Unmarked-Text",
+                   Utf8Text,ReadAll(UnmarkedBuffer))
+
+        std::stringbuf LoneSource(String("\x00" "a\xDC\x00\x00" "b",6));
+        Utf16InputBuffer LoneBuffer(&LoneSource,ByteOrder::Big);
+        TEST_EQUAL("Utf16InputBuffer-LoneSurrogate-Text",
+                   String("a"),ReadAll(LoneBuffer))
+        TEST_EQUAL("Utf16InputBuffer-LoneSurrogate-IsValid",
+                   false,LoneBuffer.IsValid())
+    }//Utf16Input
+
+    {//Utf16Output
+        std::stringbuf Dest;
+        Utf16OutputBuffer OutputBuffer(&Dest,ByteOrder::Big,true,17);
+        std::ostream Output(&OutputBuffer);
+        Output << Utf8Text;
+        Output.flush();
+        TEST_EQUAL("Utf16OutputBuffer-Text",
+                   "\xFE\xFF" + Utf16Text,Dest.str())
+        TEST_EQUAL("Utf16OutputBuffer-IsValid",
+                   true,OutputBuffer.IsValid())
+
+        std::stringbuf InvalidDest;
+        Utf16OutputBuffer InvalidBuffer(&InvalidDest,ByteOrder::Little);
+        std::ostream InvalidOutput(&InvalidBuffer);
+        InvalidOutput << "ok\xFF";
+        InvalidOutput.flush();
+        TEST_EQUAL("Utf16OutputBuffer-Invalid-Text",
+                   String("o\0k\0",4),InvalidDest.str())
+        TEST_EQUAL("Utf16OutputBuffer-Invalid-Failed",
+                   true,InvalidOutput.bad() && !InvalidBuffer.IsValid())
+    }//Utf16Output
+}
+
+#endif
@@ -0,0 +1,162 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_UnicodeToolsTests_h
+#define Mezz_IOStreams_UnicodeToolsTests_h
+
+/// @file
+/// @brief This file tests the functionality of the UnicodeTools utilities.
+
+#include "MezzTest.h"
+
+#include "UnicodeTools.h"
+
+#include <string>
+#include <vector>
+
+/// @brief Gets the bytes of UTF-16 text in a byte order.
+/// @param Text The text to get the bytes of.
+/// @param Order The byte order to use.
+/// @return Returns the code units of Text laid out in the requested order.
+inline Mezzanine::String Utf16Bytes(const std::u16string& Text, const Mezzanine::ByteOrder Order)
+{
+    Mezzanine::String Bytes;
+    for( const char16_t Unit : Text )
+    {
+        const char Low = static_cast<char>( Unit & 0xFF );
+        const char High = static_cast<char>( Unit >> 8 );
+        Bytes.push_back( Order == Mezzanine::ByteOrder::Little ? Low : High );
+        Bytes.push_back( Order == Mezzanine::ByteOrder::Little ? High : Low );
+    }
+    return Bytes;
+}
+
+AUTOMATIC_TEST_GROUP(UnicodeToolsTests,UnicodeTools)
+{
+    using namespace Mezzanine;
+
+    // ASCII long enough for the vector paths, then two, three and four byte characters.
+    const String Utf8Text = "Plain ASCII text that is long enough to fill a vector. "
+                            "W\xC3\xB6rld \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x98\x80 end";
+    const std::u16string Utf16Text = u"Plain ASCII text that is long enough to fill a vector. "
+                                     u"Wörld 日本 \U0001F600 end";
+
+    {//Validate
+        auto ValidLength = [](const String& Text) -> size_t {
+            return static_cast<size_t>( UnicodeTools::ValidateUtf8(Text.data(),Text.data() + Text.size()) - Text.data() );
+        };
+        TEST_EQUAL("ValidateUtf8(const_Char8*,const_Char8*)-Valid",
+                   Utf8Text.size(),ValidLength(Utf8Text))
+        TEST_EQUAL("ValidateUtf8(const_Char8*,const_Char8*)-Overlong",
+                   size_t(1),ValidLength("a\xC0\xAF"))
+        TEST_EQUAL("ValidateUtf8(const_Char8*,const_Char8*)-Surrogate",
+                   size_t(1),ValidLength("a\xED\xA0\x80"))
+        TEST_EQUAL("ValidateUtf8(const_Char8*,const_Char8*)-TooLarge",
+                   size_t(1),ValidLength("a\xF4\x90\x80\x80"))
+        TEST_EQUAL("ValidateUtf8(const_Char8*,const_Char8*)-StrayContinuation",
+                   size_t(2),ValidLength("\xC3\xB6\x80"))
+        TEST_EQUAL("ValidateUtf8(const_Char8*,const_Char8*)-AfterLongAscii",
+                   size_t(40),ValidLength(String(40,'x') + "\xFF" + String(40,'x')))
+        TEST_EQUAL("ValidateUtf8(const_Char8*,const_Char8*)-CutOff",
+                   size_t(2),ValidLength("ab\xF0\x9F\x98"))
+
+        const String CutOff = "\xF0\x9F\x98";
+        const String Broken = "\xE6\x41";
+        TEST_EQUAL("IsIncompleteUtf8(const_Char8*,const_Char8*)-CutOff",
+                   true,UnicodeTools::IsIncompleteUtf8(CutOff.data(),CutOff.data() + CutOff.size()))
+        TEST_EQUAL("IsIncompleteUtf8(const_Char8*,const_Char8*)-Broken",
+                   false,UnicodeTools::IsIncompleteUtf8(Broken.data(),Broken.data() + Broken.size()))
+        TEST_EQUAL("IsIncompleteUtf8(const_Char8*,const_Char8*)-Empty",
+                   false,UnicodeTools::IsIncompleteUtf8(CutOff.data(),CutOff.data()))
+    }//Validate
+
+    {//FromUtf16
+        auto ToUtf8 = [](const String& Source, const ByteOrder Order, UnicodeTools::TranscodeResult& Result) -> String {
+            std::vector<Char8> Dest( UnicodeTools::GetUtf8Capacity( Source.size() ) + 1 );
+            Result = UnicodeTools::Utf16ToUtf8(Source.data(),Source.size(),Order,Dest.data());
+            return String(Dest.data(),Result.Written);
+        };
+        UnicodeTools::TranscodeResult Result;
+        TEST_EQUAL("Utf16ToUtf8(const_Char8*,const_size_t,const_ByteOrder,Char8*)-Little",
+                   Utf8Text,ToUtf8(Utf16Bytes(Utf16Text,ByteOrder::Little),ByteOrder::Little,Result))
+        TEST_EQUAL("Utf16ToUtf8(const_Char8*,const_size_t,const_ByteOrder,Char8*)-Little-Read",
+                   Utf16Text.size() * 2,Result.Read)
+        TEST_EQUAL("Utf16ToUtf8(const_Char8*,const_size_t,const_ByteOrder,Char8*)-Big",
+                   Utf8Text,ToUtf8(Utf16Bytes(Utf16Text,ByteOrder::Big),ByteOrder::Big,Result))
+
+        TEST_EQUAL("Utf16ToUtf8(const_Char8*,const_size_t,const_ByteOrder,Char8*)-CutOffPair",
+                   String("ab"),ToUtf8(Utf16Bytes(u"ab\xD83D",ByteOrder::Little) + "x",ByteOrder::Little,Result))
+        TEST_EQUAL("Utf16ToUtf8(const_Char8*,const_size_t,const_ByteOrder,Char8*)-CutOffPair-Read",
+                   size_t(4),Result.Read)
+        TEST_EQUAL("Utf16ToUtf8(const_Char8*,const_size_t,const_ByteOrder,Char8*)-CutOffPair-Valid",
+                   true,Result.Valid)
+        TEST_EQUAL("Utf16ToUtf8(const_Char8*,const_size_t,const_ByteOrder,Char8*)-LoneSurrogate",
+                   String("a"),ToUtf8(Utf16Bytes(u"a\xDC00z",ByteOrder::Big),ByteOrder::Big,Result))
+        TEST_EQUAL("Utf16ToUtf8(const_Char8*,const_size_t,const_ByteOrder,Char8*)-LoneSurrogate-Valid",
+                   false,Result.Valid)
+        TEST_EQUAL("Utf16ToUtf8(const_Char8*,const_size_t,const_ByteOrder,Char8*)-LoneSurrogate-Read",
+                   size_t(2),Result.Read)
+    }//FromUtf16
+
+    {//ToUtf16
+        auto ToUtf16 = [](const String& Source, const ByteOrder Order, UnicodeTools::TranscodeResult& Result) -> String {
+            std::vector<Char8> Dest( UnicodeTools::GetUtf16Capacity( Source.size() ) + 1 );
+            Result = UnicodeTools::Utf8ToUtf16(Source.data(),Source.size(),Order,Dest.data());
+            return String(Dest.data(),Result.Written);
+        };
+        UnicodeTools::TranscodeResult Result;
+        TEST_EQUAL("Utf8ToUtf16(const_Char8*,const_size_t,const_ByteOrder,Char8*)-Little",
+                   Utf16Bytes(Utf16Text,ByteOrder::Little),ToUtf16(Utf8Text,ByteOrder::Little,Result))
+        TEST_EQUAL("Utf8ToUtf16(const_Char8*,const_size_t,const_ByteOrder,Char8*)-Little-Read",
+                   Utf8Text.size(),Result.Read)
+        TEST_EQUAL("Utf8ToUtf16(const_Char8*,const_size_t,const_ByteOrder,Char8*)-Big",
+                   Utf16Bytes(Utf16Text,ByteOrder::Big),ToUtf16(Utf8Text,ByteOrder::Big,Result))
+
+        TEST_EQUAL("Utf8ToUtf16(const_Char8*,const_size_t,const_ByteOrder,Char8*)-CutOff",
+                   Utf16Bytes(u"ab",ByteOrder::Little),ToUtf16("ab\xE6\x97",ByteOrder::Little,Result))
+        TEST_EQUAL("Utf8ToUtf16(const_Char8*,const_size_t,const_ByteOrder,Char8*)-CutOff-Valid",
+                   true,Result.Valid && Result.Read == 2)
+        TEST_EQUAL("Utf8ToUtf16(const_Char8*,const_size_t,const_ByteOrder,Char8*)-Invalid",
+                   Utf16Bytes(u"ab",ByteOrder::Little),ToUtf16("ab\xFF" "cd",ByteOrder::Little,Result))
+        TEST_EQUAL("Utf8ToUtf16(const_Char8*,const_size_t,const_ByteOrder,Char8*)-Invalid-Valid",
+                   false,Result.Valid)
+    }//ToUtf16
+}
+
+#endif
@@ -0,0 +1,128 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_VarIntToolsTests_h
+#define Mezz_IOStreams_VarIntToolsTests_h
+
+/// @file
+/// @brief This file tests the functionality of the VarIntTools utilities.
+
+#include "MezzTest.h"
+
+#include "VarIntTools.h"
+
+#include <limits>
+#include <vector>
+
+AUTOMATIC_TEST_GROUP(VarIntToolsTests,VarIntTools)
+{
+    using namespace Mezzanine;
+
+    {//ZigZag
+        TEST_EQUAL("ZigZagEncode(const_Int64)-Zero",
+                   UInt64(0),VarIntTools::ZigZagEncode(0))
+        TEST_EQUAL("ZigZagEncode(const_Int64)-MinusOne",
+                   UInt64(1),VarIntTools::ZigZagEncode(-1))
+        TEST_EQUAL("ZigZagEncode(const_Int64)-One",
+                   UInt64(2),VarIntTools::ZigZagEncode(1))
+        TEST_EQUAL("ZigZagEncode(const_Int64)-Min",
+                   std::numeric_limits<UInt64>::max(),VarIntTools::ZigZagEncode(std::numeric_limits<Int64>::min()))
+        TEST_EQUAL("ZigZagDecode(const_UInt64)-MinusTwo",
+                   Int64(-2),VarIntTools::ZigZagDecode(3))
+        TEST_EQUAL("ZigZagDecode(const_UInt64)-Max",
+                   std::numeric_limits<Int64>::max(),VarIntTools::ZigZagDecode(std::numeric_limits<UInt64>::max() - 1))
+    }//ZigZag
+
+    {//VarInt
+        UInt8 Encoded[VarIntTools::MaxVarIntSize] = {};
+        TEST_EQUAL("EncodeVarInt(UInt64,UInt8*)-OneByte",
+                   size_t(1),VarIntTools::EncodeVarInt(127,Encoded))
+        TEST_EQUAL("EncodeVarInt(UInt64,UInt8*)-TwoBytes-Size",
+                   size_t(2),VarIntTools::EncodeVarInt(300,Encoded))
+        TEST_EQUAL("EncodeVarInt(UInt64,UInt8*)-TwoBytes-Value",
+                   true,Encoded[0] == 0xAC && Encoded[1] == 0x02)
+        TEST_EQUAL("EncodeVarInt(UInt64,UInt8*)-Max",
+                   VarIntTools::MaxVarIntSize,VarIntTools::EncodeVarInt(std::numeric_limits<UInt64>::max(),Encoded))
+
+        UInt64 Decoded = 0;
+        TEST_EQUAL("DecodeVarInt(const_UInt8*,const_size_t,UInt64&)-Max-Size",
+                   VarIntTools::MaxVarIntSize,VarIntTools::DecodeVarInt(Encoded,sizeof(Encoded),Decoded))
+        TEST_EQUAL("DecodeVarInt(const_UInt8*,const_size_t,UInt64&)-Max-Value",
+                   std::numeric_limits<UInt64>::max(),Decoded)
+        TEST_EQUAL("DecodeVarInt(const_UInt8*,const_size_t,UInt64&)-Incomplete",
+                   size_t(0),VarIntTools::DecodeVarInt(Encoded,5,Decoded))
+        Encoded[9] = 0x02;
+        TEST_EQUAL("DecodeVarInt(const_UInt8*,const_size_t,UInt64&)-Overflow",
+                   size_t(0),VarIntTools::DecodeVarInt(Encoded,sizeof(Encoded),Decoded))
+    }//VarInt
+
+    {//StreamVByte
+        Boole AllMatched = true;
+        Boole AllSized = true;
+        for( const size_t Count : { size_t(0), size_t(1), size_t(3), size_t(4), size_t(9), size_t(64), size_t(1001) } )
+        {
+            std::vector<UInt32> Values(Count);
+            for( size_t Index = 0 ; Index < Count ; ++Index )
+            {
+                // Cycle through every encoded length, in an order that doesn't line up with groups of four.
+                const UInt32 Shift = static_cast<UInt32>( ( Index * 5 ) % 4 ) * 8;
+                Values[Index] = ( UInt32(0xFF) << Shift ) | static_cast<UInt32>(Index % 256);
+            }
+            std::vector<UInt8> Encoded(VarIntTools::StreamVByteMaxSize(Count));
+            const size_t EncodedSize = VarIntTools::StreamVByteEncode(Values.data(),Count,Encoded.data());
+            const size_t ControlSize = VarIntTools::StreamVByteControlSize(Count);
+            AllSized = AllSized && EncodedSize == ControlSize + VarIntTools::StreamVByteDataSize(Encoded.data(),Count);
+
+            std::vector<UInt32> Decoded(Count);
+            AllSized = AllSized && EncodedSize == VarIntTools::StreamVByteDecode(Encoded.data(),Count,Decoded.data());
+            AllMatched = AllMatched && Values == Decoded;
+        }
+        TEST_EQUAL("StreamVByteDecode(const_UInt8*,const_size_t,UInt32*)-RoundTrip",
+                   true,AllMatched)
+        TEST_EQUAL("StreamVByteDataSize(const_UInt8*,const_size_t)",
+                   true,AllSized)
+
+        const UInt32 Small[5] = { 1, 2, 3, 4, 5 };
+        UInt8 SmallEncoded[VarIntTools::StreamVByteMaxSize(5)] = {};
+        TEST_EQUAL("StreamVByteEncode(const_UInt32*,const_size_t,UInt8*)-SmallValues",
+                   size_t(7),VarIntTools::StreamVByteEncode(Small,5,SmallEncoded))
+    }//StreamVByte
+}
+
+#endif // Mezz_IOStreams_VarIntToolsTests_h
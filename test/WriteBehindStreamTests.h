@@ -0,0 +1,154 @@
+// � Copyright 2010 - 2019 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_IOStreams_WriteBehindStreamTests_h
+#define Mezz_IOStreams_WriteBehindStreamTests_h
+
+/// @file
+/// @brief This file tests the functionality of the WriteBehindOutputStream class.
+
+#include "MezzTest.h"
+
+#include "WriteBehindStream.h"
+
+#include <cstdio>
+
+/// @brief Reads an entire file into a String.
+/// @param FileName The name of the file to read.
+/// @return Returns a String containing the contents of the file.
+inline Mezzanine::String ReadWriteBehindTestFile(const Mezzanine::String& FileName)
+{
+    std::ifstream File(FileName,std::ios::in | std::ios::binary);
+    return Mezzanine::String(std::istreambuf_iterator<char>(File),std::istreambuf_iterator<char>());
+}
+
+AUTOMATIC_TEST_GROUP(WriteBehindStreamTests,WriteBehindStream)
+{
+    using namespace Mezzanine;
+
+    // Set everything up for our test.
+    const String TestFileName = "WriteBehindStreamTests.bin";
+    String TestBuffer(5000,'\0');
+    for( size_t CurrByte = 0 ; CurrByte < TestBuffer.size() ; ++CurrByte )
+    {
+        TestBuffer[CurrByte] = static_cast<Char8>( ( CurrByte * 13 + CurrByte / 97 ) % 256 );
+    }
+
+    {//Opening
+        WriteBehindOutputStream BadStream("ZZZ_NoSuchDirectory/ZZZ_NoSuchFile.bin");
+        TEST_EQUAL("IsOpen()_const-BadPath",
+                   false,BadStream.IsOpen())
+        TEST_EQUAL("Fail()_const-BadPath",
+                   true,BadStream.Fail())
+        TEST_EQUAL("Write(const_void*,StreamSize)-BadPath",
+                   false,BadStream.Write(TestBuffer.data(),10))
+    }//Opening
+
+    {//Writing
+        WriteBehindOutputStream TestStream(TestFileName,false,256,3);
+        TEST_EQUAL("IsOpen()_const-TestFile",
+                   true,TestStream.IsOpen())
+        TEST_EQUAL("GetIdentifier()_const",
+                   TestFileName,TestStream.GetIdentifier())
+
+        Boole AllValid = true;
+        for( size_t Written = 0 ; Written < TestBuffer.size() ; Written += 100 )
+        {
+            AllValid = TestStream.Write(TestBuffer.data() + Written,100) && AllValid;
+        }
+        TEST_EQUAL("Write(const_void*,StreamSize)-Valid",
+                   true,AllValid)
+        TEST_EQUAL("GetWritePosition()",
+                   StreamPos(5000),TestStream.GetWritePosition())
+        TEST_EQUAL("GetSize()_const",
+                   StreamSize(5000),TestStream.GetSize())
+        TEST_EQUAL("Flush()",
+                   true,TestStream.Flush())
+        TEST_EQUAL("FlushAndWait()",
+                   true,TestStream.FlushAndWait())
+        TEST_EQUAL("FlushAndWait()-Value",
+                   TestBuffer,ReadWriteBehindTestFile(TestFileName))
+
+        TestStream.SetWritePosition(StreamPos(10));
+        TestStream.Write("Overwrite",9);
+        TEST_EQUAL("SetWritePosition(StreamPos)-Position",
+                   StreamPos(19),TestStream.GetWritePosition())
+        TEST_EQUAL("SetWritePosition(StreamPos)-Size",
+                   StreamSize(5000),TestStream.GetSize())
+        TestStream.CloseFile();
+        TEST_EQUAL("CloseFile()-IsOpen",
+                   false,TestStream.IsOpen())
+
+        String Expected = TestBuffer;
+        Expected.replace(10,9,"Overwrite");
+        TEST_EQUAL("CloseFile()-Value",
+                   Expected,ReadWriteBehindTestFile(TestFileName))
+    }//Writing
+
+    {//Appending
+        {
+            WriteBehindOutputStream TestStream(TestFileName,true,256,3);
+            TEST_EQUAL("OpenFile(const_String&,const_Boole)-Append-Size",
+                       StreamSize(5000),TestStream.GetSize())
+            TestStream.Write("Appended",8);
+        }
+        TEST_EQUAL("OpenFile(const_String&,const_Boole)-Append-Value",
+                   String("Appended"),ReadWriteBehindTestFile(TestFileName).substr(5000))
+    }//Appending
+
+    {//WritingAfterClose
+        WriteBehindOutputStream TestStream(TestFileName,false,256,3);
+        TestStream.Write("Open",4);
+        TestStream.CloseFile();
+        TEST_EQUAL("CloseFile()-WriteAfterClose",
+                   false,TestStream.Write("Closed",6))
+        TEST_EQUAL("CloseFile()-SizeAfterClose",
+                   StreamSize(0),TestStream.GetSize())
+
+        TestStream.OpenFile(TestFileName,true);
+        TestStream.Write("Reopened",8);
+        TestStream.CloseFile();
+        TEST_EQUAL("CloseFile()-ReopenValue",
+                   String("OpenReopened"),ReadWriteBehindTestFile(TestFileName))
+    }//WritingAfterClose
+
+    std::remove(TestFileName.c_str());
+}
+
+#endif // Mezz_IOStreams_WriteBehindStreamTests_h